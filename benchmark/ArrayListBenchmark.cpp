@@ -0,0 +1,127 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Measures element access on ArrayList against a raw array and ConcurrentArrayList. The load* functions are kept out
+// of line so their code can be inspected, e.g. `objdump -d --no-show-raw-insn ArrayListBenchmark | grep -A8 loadAt`:
+// loadAt is a bounds compare followed by a single load, and loadIterated is a plain pointer walk.
+// The growth runs append without reserving, so every doubling relocates the whole list; String is trivially
+// relocatable and moves with one memmove per doubling.
+// Usage: ArrayListBenchmark [element count] [passes]
+
+#include <Cedar/Core/Container/ArrayList.h>
+#include <Cedar/Core/Container/ConcurrentArrayList.h>
+#include <Cedar/Core/String.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Container;
+
+extern "C" [[gnu::noinline]] Int64 loadAt(const ArrayList<Int64>& list, Size index) {
+    return list[index];
+}
+
+extern "C" [[gnu::noinline]] Int64 loadIterated(const ArrayList<Int64>& list) {
+    Int64 sum = 0;
+    for (Int64 value : list) {
+        sum += value;
+    }
+    return sum;
+}
+
+template<typename Body>
+static double measure(const char* name, Size elements, Size passes, Body body) {
+    Int64 sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (Size pass = 0; pass < passes; ++pass) {
+        // Stops the compiler from hoisting a pass out of the loop because it reads the same memory as the last.
+        asm volatile("" ::: "memory");
+        sink += body();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double nanosPerElement = elapsed * 1e9 / static_cast<double>(elements * passes);
+    std::printf("%-34s %8.3f ns/element  (checksum %lld)\n", name, nanosPerElement, static_cast<long long>(sink));
+    return nanosPerElement;
+}
+
+int main(int argc, char** argv) {
+    Size elements = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+    Size passes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 50;
+
+    auto* raw = new Int64[elements];
+    ArrayList<Int64> list(elements);
+    ConcurrentArrayList<Int64> concurrent(elements);
+    for (Size i = 0; i < elements; ++i) {
+        raw[i] = static_cast<Int64>(i);
+        list.append(static_cast<Int64>(i));
+        concurrent.append(static_cast<Int64>(i));
+    }
+
+    std::printf("%llu elements, %llu passes\n", static_cast<unsigned long long>(elements),
+                static_cast<unsigned long long>(passes));
+    measure("raw array", elements, passes, [&]() {
+        Int64 sum = 0;
+        for (Size i = 0; i < elements; ++i) sum += raw[i];
+        return sum;
+    });
+    measure("ArrayList operator[]", elements, passes, [&]() {
+        Int64 sum = 0;
+        for (Size i = 0; i < elements; ++i) sum += list[i];
+        return sum;
+    });
+    measure("ArrayList operator[] (out of line)", elements, passes, [&]() {
+        Int64 sum = 0;
+        for (Size i = 0; i < elements; ++i) sum += loadAt(list, i);
+        return sum;
+    });
+    measure("ArrayList iterator", elements, passes, [&]() {
+        return loadIterated(list);
+    });
+    measure("ConcurrentArrayList get", elements, passes / 10 + 1, [&]() {
+        Int64 sum = 0;
+        for (Size i = 0; i < elements; ++i) sum += concurrent.get(i);
+        return sum;
+    });
+    measure("ConcurrentArrayList forEach", elements, passes, [&]() {
+        Int64 sum = 0;
+        concurrent.forEach([&sum](Int64 value) { sum += value; });
+        return sum;
+    });
+
+    measure("growth: append Int64", elements, 1, [&]() {
+        ArrayList<Int64> grown;
+        for (Size i = 0; i < elements; ++i) grown.append(static_cast<Int64>(i));
+        return grown[elements - 1];
+    });
+    String text("long enough to be stored on the heap");
+    measure("growth: append String", elements, 1, [&]() {
+        ArrayList<String> grown;
+        for (Size i = 0; i < elements; ++i) grown.append(text);
+        return static_cast<Int64>(grown.size());
+    });
+
+    delete[] raw;
+    return 0;
+}
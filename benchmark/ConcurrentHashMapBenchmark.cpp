@@ -0,0 +1,145 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Measures ConcurrentHashMap throughput under contention at 1, 8, 32 and 64 threads, next to a HashMap behind a
+// single Mutex. Usage: ConcurrentHashMapBenchmark [operations per run]
+
+#include <Cedar/Core/Container/ConcurrentHashMap.h>
+#include <Cedar/Core/Container/HashMap.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Container;
+using namespace Cedar::Core::Threading;
+
+static constexpr UInt64 KeySpace = 1 << 20;
+static constexpr Int32 ThreadCounts[] = {1, 8, 32, 64};
+
+struct Workload {
+    const char* name;
+    UInt32 readPercent;     // The remaining operations are split evenly between insert and remove
+};
+
+static constexpr Workload Workloads[] = {
+        {"read-mostly (90% find)", 90},
+        {"mixed (50% find)", 50},
+};
+
+class LockedHashMap {
+public:
+    void insert(UInt64 key, UInt64 value) {
+        LockGuard<Mutex> lock(m_lock);
+        m_map.insert(key, value);
+    }
+
+    Boolean find(UInt64 key, UInt64& value) {
+        LockGuard<Mutex> lock(m_lock);
+        UInt64* found = m_map.find(key);
+        if (found) value = *found;
+        return found != nullptr;
+    }
+
+    void remove(UInt64 key) {
+        LockGuard<Mutex> lock(m_lock);
+        m_map.remove(key);
+    }
+
+private:
+    Mutex m_lock;
+    HashMap<UInt64, UInt64> m_map;
+};
+
+static UInt64 nextRandom(UInt64& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+template<typename Map>
+static double run(Map& map, const Workload& workload, Int32 threadCount, UInt64 totalOperations) {
+    for (UInt64 key = 0; key < KeySpace; key += 2) {
+        map.insert(key, key);
+    }
+
+    UInt64 operationsPerThread = totalOperations / threadCount;
+    Thread** threads = new Thread*[threadCount];
+    for (Int32 t = 0; t < threadCount; ++t) {
+        Function<void> body = [&map, &workload, operationsPerThread, t]() {
+            UInt64 state = 0x9E3779B97F4A7C15ULL * (t + 1);
+            UInt64 sink = 0;
+            for (UInt64 i = 0; i < operationsPerThread; ++i) {
+                UInt64 random = nextRandom(state);
+                UInt64 key = random % KeySpace;
+                UInt32 choice = static_cast<UInt32>((random >> 32) % 100);
+                if (choice < workload.readPercent) {
+                    UInt64 value = 0;
+                    sink += map.find(key, value) ? value : 0;
+                } else if (choice % 2 == 0) {
+                    map.insert(key, i);
+                } else {
+                    map.remove(key);
+                }
+            }
+            if (sink == 1) std::printf(" ");
+        };
+        threads[t] = new Thread(body);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (Int32 t = 0; t < threadCount; ++t) {
+        threads[t]->start();
+    }
+    for (Int32 t = 0; t < threadCount; ++t) {
+        threads[t]->join();
+        delete threads[t];
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    delete[] threads;
+
+    return static_cast<double>(operationsPerThread * threadCount) / elapsed / 1e6;
+}
+
+int main(int argc, char** argv) {
+    UInt64 totalOperations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16000000;
+
+    for (const Workload& workload : Workloads) {
+        std::printf("%s, %llu operations per run\n", workload.name, static_cast<unsigned long long>(totalOperations));
+        std::printf("%8s %22s %22s\n", "threads", "ConcurrentHashMap", "HashMap + Mutex");
+        for (Int32 threads : ThreadCounts) {
+            ConcurrentHashMap<UInt64, UInt64> concurrent;
+            double concurrentRate = run(concurrent, workload, threads, totalOperations);
+            LockedHashMap locked;
+            double lockedRate = run(locked, workload, threads, totalOperations);
+            std::printf("%8d %17.2f Mop/s %17.2f Mop/s\n", threads, concurrentRate, lockedRate);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Measures event-ID deduplication against a set much larger than the caches, probing one key at a time with
+// contains()/insert() and in batches with containsMany()/insertMany(). Usage: HashSetBenchmark [set size]
+
+#include <Cedar/Core/Container/HashSet.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Container;
+
+static constexpr Size Batch = 256;
+
+static UInt64 nextRandom(UInt64& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+template<typename Body>
+static double timeMillis(Body body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    Size setSize = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+
+    // Half the probes hit IDs already seen, half are new.
+    UInt64* keys = new UInt64[setSize];
+    UInt64 state = 0x9E3779B97F4A7C15ull;
+    for (Size i = 0; i < setSize; ++i) {
+        keys[i] = nextRandom(state);
+    }
+    UInt64* probes = new UInt64[setSize];
+    for (Size i = 0; i < setSize; ++i) {
+        probes[i] = i % 2 ? keys[nextRandom(state) % setSize] : nextRandom(state);
+    }
+    Boolean* results = new Boolean[Batch];
+
+    HashSet<UInt64> single;
+    HashSet<UInt64> batched;
+    double singleInsert = timeMillis([&]() {
+        for (Size i = 0; i < setSize; ++i) {
+            single.insert(keys[i]);
+        }
+    });
+    double batchedInsert = timeMillis([&]() {
+        for (Size i = 0; i < setSize; i += Batch) {
+            batched.insertMany(keys + i, setSize - i < Batch ? setSize - i : Batch);
+        }
+    });
+
+    Size singleHits = 0;
+    Size batchedHits = 0;
+    double singleContains = timeMillis([&]() {
+        for (Size i = 0; i < setSize; ++i) {
+            singleHits += single.contains(probes[i]);
+        }
+    });
+    double batchedContains = timeMillis([&]() {
+        for (Size i = 0; i < setSize; i += Batch) {
+            Size count = setSize - i < Batch ? setSize - i : Batch;
+            batched.containsMany(probes + i, count, results);
+            for (Size j = 0; j < count; ++j) {
+                batchedHits += results[j];
+            }
+        }
+    });
+
+    std::printf("%llu keys, %llu hits (%llu batched)\n", setSize, singleHits, batchedHits);
+    std::printf("insert       %8.1f ms  %6.1f ns/key\n", singleInsert, singleInsert * 1e6 / setSize);
+    std::printf("insertMany   %8.1f ms  %6.1f ns/key\n", batchedInsert, batchedInsert * 1e6 / setSize);
+    std::printf("contains     %8.1f ms  %6.1f ns/key\n", singleContains, singleContains * 1e6 / setSize);
+    std::printf("containsMany %8.1f ms  %6.1f ns/key\n", batchedContains, batchedContains * 1e6 / setSize);
+
+    delete[] results;
+    delete[] probes;
+    delete[] keys;
+    return 0;
+}
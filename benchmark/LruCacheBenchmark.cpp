@@ -0,0 +1,161 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Replays a Zipfian key stream against LruCache from several threads, reading through the cache and filling it on a
+// miss, for both policies with one shard and with the default shard count.
+// Usage: LruCacheBenchmark [operations per run] [distinct keys] [capacity] [skew]
+
+#include <Cedar/Core/Container/LruCache.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Container;
+using namespace Cedar::Core::Threading;
+
+static constexpr Int32 ThreadCounts[] = {1, 4, 16};
+
+static UInt64 nextRandom(UInt64& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+// Draws keys from a Zipf distribution over [0, keys) by binary search in the cumulative probabilities. Ranks are
+// scattered with a multiplicative hash so that popular keys do not cluster in the key space.
+class ZipfianStream {
+public:
+    ZipfianStream(Size keys, double skew) : m_keys(keys), m_cumulative(new double[keys]) {
+        double total = 0;
+        for (Size i = 0; i < keys; ++i) {
+            total += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+            m_cumulative[i] = total;
+        }
+        for (Size i = 0; i < keys; ++i) {
+            m_cumulative[i] /= total;
+        }
+    }
+
+    ~ZipfianStream() {
+        delete[] m_cumulative;
+    }
+
+    void fill(UInt64* out, Size count, UInt64 seed) const {
+        UInt64 state = seed * 0x9E3779B97F4A7C15ull | 1;
+        for (Size i = 0; i < count; ++i) {
+            double u = static_cast<double>(nextRandom(state) >> 11) / 9007199254740992.0;
+            Size low = 0;
+            Size high = m_keys - 1;
+            while (low < high) {
+                Size middle = (low + high) / 2;
+                if (m_cumulative[middle] < u) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            out[i] = low * 0xD6E8FEB86659FD93ull;
+        }
+    }
+
+private:
+    Size m_keys;
+    double* m_cumulative;
+};
+
+struct Result {
+    double throughput;
+    double hitRate;
+};
+
+static Result run(CachePolicy policy, Size shards, Int32 threadCount, UInt64** streams, Size perThread,
+                  Size capacity) {
+    LruCache<UInt64, UInt64> cache(capacity, policy, shards);
+    Thread** threads = new Thread*[threadCount];
+    for (Int32 t = 0; t < threadCount; ++t) {
+        UInt64* keys = streams[t];
+        Function<void> body = [&cache, keys, perThread]() {
+            for (Size i = 0; i < perThread; ++i) {
+                UInt64 value;
+                if (!cache.get(keys[i], value)) {
+                    cache.put(keys[i], keys[i] + 1);
+                }
+            }
+        };
+        threads[t] = new Thread(body);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (Int32 t = 0; t < threadCount; ++t) {
+        threads[t]->start();
+    }
+    for (Int32 t = 0; t < threadCount; ++t) {
+        threads[t]->join();
+        delete threads[t];
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    delete[] threads;
+
+    CacheStatistics statistics = cache.statistics();
+    return {static_cast<double>(perThread * threadCount) / elapsed / 1e6,
+            100.0 * statistics.hits / (statistics.hits + statistics.misses)};
+}
+
+int main(int argc, char** argv) {
+    UInt64 totalOperations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8000000;
+    Size keys = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+    Size capacity = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 65536;
+    double skew = argc > 4 ? std::strtod(argv[4], nullptr) : 0.99;
+
+    ZipfianStream stream(keys, skew);
+    std::printf("%llu operations per run, %llu keys, capacity %llu, skew %.2f\n",
+                static_cast<unsigned long long>(totalOperations), keys, capacity, skew);
+    std::printf("%8s %-6s %7s %16s %9s\n", "threads", "policy", "shards", "throughput", "hit rate");
+    for (Int32 threadCount : ThreadCounts) {
+        Size perThread = totalOperations / threadCount;
+        UInt64** streams = new UInt64*[threadCount];
+        for (Int32 t = 0; t < threadCount; ++t) {
+            streams[t] = new UInt64[perThread];
+            stream.fill(streams[t], perThread, t + 1);
+        }
+
+        for (CachePolicy policy : {CachePolicy::Lru, CachePolicy::Clock}) {
+            for (Size shards : {Size(1), LruCache<UInt64, UInt64>::DefaultShardCount}) {
+                Result result = run(policy, shards, threadCount, streams, perThread, capacity);
+                std::printf("%8d %-6s %7llu %10.2f Mop/s %8.1f%%\n", threadCount,
+                            policy == CachePolicy::Lru ? "LRU" : "CLOCK", shards, result.throughput, result.hitRate);
+            }
+        }
+
+        for (Int32 t = 0; t < threadCount; ++t) {
+            delete[] streams[t];
+        }
+        delete[] streams;
+    }
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Measures queue throughput for one-to-one, many-to-one and many-to-many hand-offs, comparing each lock-free queue
+// with an ArrayList behind a Mutex. Usage: QueueBenchmark [items per run]
+
+#include <Cedar/Core/Container/ArrayList.h>
+#include <Cedar/Core/Container/Queue.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Container;
+using namespace Cedar::Core::Threading;
+
+static constexpr Size QueueCapacity = 1024;
+
+// Bounded FIFO made of an ArrayList and a read index, compacted once half of it has been consumed.
+class LockedQueue {
+public:
+    explicit LockedQueue(Size capacity) : m_capacity(capacity) {}
+
+    Boolean tryPush(UInt64 value) {
+        LockGuard<Mutex> lock(m_lock);
+        if (m_items.size() - m_head >= m_capacity) {
+            return false;
+        }
+        m_items.append(value);
+        return true;
+    }
+
+    Boolean tryPop(UInt64& value) {
+        LockGuard<Mutex> lock(m_lock);
+        if (m_head == m_items.size()) {
+            return false;
+        }
+        value = m_items[m_head++];
+        if (m_head * 2 > m_items.size()) {
+            m_items.removeRange(0, m_head);
+            m_head = 0;
+        }
+        return true;
+    }
+
+private:
+    Mutex m_lock;
+    Size m_capacity;
+    ArrayList<UInt64> m_items;
+    Size m_head = 0;
+};
+
+template<typename QueueType>
+static double run(Int32 producers, Int32 consumers, UInt64 totalItems) {
+    QueueType queue(QueueCapacity);
+    UInt64 perProducer = totalItems / producers;
+    UInt64 perConsumer = perProducer * producers / consumers;
+
+    Thread** threads = new Thread*[producers + consumers];
+    for (Int32 p = 0; p < producers; ++p) {
+        Function<void> produce = [&queue, perProducer]() {
+            for (UInt64 i = 0; i < perProducer; ++i) {
+                while (!queue.tryPush(i)) {
+                    Thread::yield();
+                }
+            }
+        };
+        threads[p] = new Thread(produce);
+    }
+    for (Int32 c = 0; c < consumers; ++c) {
+        Function<void> consume = [&queue, perConsumer]() {
+            UInt64 value, sink = 0;
+            for (UInt64 i = 0; i < perConsumer; ++i) {
+                while (!queue.tryPop(value)) {
+                    Thread::yield();
+                }
+                sink += value;
+            }
+            if (sink == 1) std::printf(" ");
+        };
+        threads[producers + c] = new Thread(consume);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (Int32 t = 0; t < producers + consumers; ++t) {
+        threads[t]->start();
+    }
+    for (Int32 t = 0; t < producers + consumers; ++t) {
+        threads[t]->join();
+        delete threads[t];
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    delete[] threads;
+
+    return static_cast<double>(perConsumer * consumers) / elapsed / 1e6;
+}
+
+int main(int argc, char** argv) {
+    UInt64 totalItems = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8000000;
+    std::printf("%llu items per run, capacity %llu\n", static_cast<unsigned long long>(totalItems),
+                static_cast<unsigned long long>(QueueCapacity));
+    std::printf("%-22s %20s %20s\n", "shape", "lock-free", "ArrayList + Mutex");
+
+    std::printf("%-22s %15.2f Mi/s %15.2f Mi/s\n", "1 -> 1 (SpscQueue)",
+                run<SpscQueue<UInt64>>(1, 1, totalItems), run<LockedQueue>(1, 1, totalItems));
+    for (Int32 producers : {4, 8}) {
+        char shape[32];
+        std::snprintf(shape, sizeof(shape), "%d -> 1 (MpscQueue)", producers);
+        std::printf("%-22s %15.2f Mi/s %15.2f Mi/s\n", shape,
+                    run<MpscQueue<UInt64>>(producers, 1, totalItems), run<LockedQueue>(producers, 1, totalItems));
+    }
+    for (Int32 threads : {2, 4, 8}) {
+        char shape[32];
+        std::snprintf(shape, sizeof(shape), "%d -> %d (Queue)", threads, threads);
+        std::printf("%-22s %15.2f Mi/s %15.2f Mi/s\n", shape,
+                    run<Queue<UInt64>>(threads, threads, totalItems), run<LockedQueue>(threads, threads, totalItems));
+    }
+    return 0;
+}
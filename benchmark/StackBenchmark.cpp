@@ -0,0 +1,105 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Measures a buffer-recycling free list, where every thread repeatedly pops a buffer and pushes it back, with
+// ConcurrentStack against a Stack behind a Mutex. Usage: StackBenchmark [operations per run]
+
+#include <Cedar/Core/Container/ConcurrentStack.h>
+#include <Cedar/Core/Container/Stack.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Container;
+using namespace Cedar::Core::Threading;
+
+static constexpr Int32 ThreadCounts[] = {1, 4, 16, 64};
+static constexpr UInt64 Buffers = 1024;
+
+class LockedStack {
+public:
+    void push(UInt64 value) {
+        LockGuard<Mutex> lock(m_lock);
+        m_stack.push(value);
+    }
+
+    Boolean tryPop(UInt64& value) {
+        LockGuard<Mutex> lock(m_lock);
+        return m_stack.tryPop(value);
+    }
+
+private:
+    Mutex m_lock;
+    Stack<UInt64> m_stack;
+};
+
+template<typename StackType>
+static double run(Int32 threadCount, UInt64 totalOperations) {
+    StackType stack;
+    for (UInt64 i = 0; i < Buffers; ++i) {
+        stack.push(i);
+    }
+
+    UInt64 perThread = totalOperations / threadCount;
+    Thread** threads = new Thread*[threadCount];
+    for (Int32 t = 0; t < threadCount; ++t) {
+        Function<void> body = [&stack, perThread]() {
+            for (UInt64 i = 0; i < perThread; ++i) {
+                UInt64 buffer;
+                if (stack.tryPop(buffer)) {
+                    stack.push(buffer);
+                }
+            }
+        };
+        threads[t] = new Thread(body);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (Int32 t = 0; t < threadCount; ++t) {
+        threads[t]->start();
+    }
+    for (Int32 t = 0; t < threadCount; ++t) {
+        threads[t]->join();
+        delete threads[t];
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    delete[] threads;
+
+    return static_cast<double>(perThread * threadCount) / elapsed / 1e6;
+}
+
+int main(int argc, char** argv) {
+    UInt64 totalOperations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8000000;
+    std::printf("pop+push pairs, %llu per run\n", static_cast<unsigned long long>(totalOperations));
+    std::printf("%8s %22s %22s\n", "threads", "ConcurrentStack", "Stack + Mutex");
+    for (Int32 threads : ThreadCounts) {
+        std::printf("%8d %17.2f Mop/s %17.2f Mop/s\n", threads, run<ConcurrentStack<UInt64>>(threads, totalOperations),
+                    run<LockedStack>(threads, totalOperations));
+    }
+    return 0;
+}
@@ -50,6 +50,7 @@ namespace Cedar::Core {
     using CChar = char;
     using CString = const CChar*;
     using Pointer = void*;
+    using ConstPointer = const void*;
 
 
 #if defined(_WIN64) || defined(__x86_64__) || defined(__ppc64__) || defined(__aarch64__)
@@ -25,83 +25,226 @@
 
 #include <Cedar/Core/BasicTypes.h>
 #include <Cedar/Core/Memory.h>
-#include <Cedar/Core/Threading/Mutex.h>
-#include <Cedar/Core/Threading/LockGuard.h>
 
 #include <Cedar/Core/Exceptions/OutOfRangeException.h>
 #include <initializer_list>
 
 namespace Cedar::Core::Container {
+    // Room for N elements inside the list object itself.
+    template<typename T, Size N>
+    class ArrayListInlineStorage {
+    protected:
+        T *inlineData() {
+            return reinterpret_cast<T *>(m_inline);
+        }
+
+    private:
+        alignas(T) Byte m_inline[N * sizeof(T)];
+    };
+
     template<typename T>
-    class ArrayList {
+    class ArrayListInlineStorage<T, 0> {
+    protected:
+        T *inlineData() {
+            return nullptr;
+        }
+    };
+
+    // Contiguous growable array. It does no locking of its own; use ConcurrentArrayList to share one between threads.
+    // With InlineCapacity above zero the first InlineCapacity elements are stored in the object and the heap is only
+    // used once the list outgrows them; InlineArrayList names that form.
+    template<typename T, Size InlineCapacity = 0>
+    class ArrayList : private ArrayListInlineStorage<T, InlineCapacity> {
     private:
-        Memory::UniquePointer<T[]> m_data;
+        using ArrayListInlineStorage<T, InlineCapacity>::inlineData;
+
+        T *m_data;
         Size m_size;
         Size m_capacity;
         Memory::Allocator<T> m_allocator;
-        mutable Threading::Mutex m_mtx;
+
+        [[nodiscard]] Boolean isInline() const {
+            return InlineCapacity != 0 && m_data == const_cast<ArrayList *>(this)->inlineData();
+        }
+
+        void releaseBuffer() {
+            if (!isInline()) {
+                m_allocator.deallocate(m_data);
+            }
+        }
+
+        // Points the list at its inline buffer, or at nothing when it has none.
+        void resetToInline() {
+            m_data = inlineData();
+            m_size = 0;
+            m_capacity = InlineCapacity;
+        }
+
+        // Takes over other's elements, stealing its heap buffer or relocating out of its inline one.
+        void takeFrom(ArrayList &other) {
+            if (other.isInline()) {
+                resetToInline();
+                Memory::relocate(m_data, other.m_data, other.m_size);
+                m_size = other.m_size;
+            } else {
+                m_data = other.m_data;
+                m_size = other.m_size;
+                m_capacity = other.m_capacity;
+            }
+            other.resetToInline();
+        }
+
+        // Capacity to grow to when at least minCapacity is needed; doubling keeps repeated appends amortised O(1).
+        [[nodiscard]] Size grownCapacity(Size minCapacity) const {
+            Size doubled = m_capacity == 0 ? 1 : m_capacity * 2;
+            return doubled > minCapacity ? doubled : minCapacity;
+        }
 
         void resizeInternal(Size newCapacity) {
+            if (newCapacity <= InlineCapacity) {
+                // Only shrinkToFit asks for this little; it moves a spilled list back into the object.
+                if (!isInline()) {
+                    T *heapData = m_data;
+                    Size size = m_size;
+                    resetToInline();
+                    Memory::relocate(m_data, heapData, size);
+                    m_size = size;
+                    m_allocator.deallocate(heapData);
+                }
+                return;
+            }
             T *newData = m_allocator.allocate(newCapacity);
+            Memory::relocate(newData, m_data, m_size);
+            releaseBuffer();
+            m_data = newData;
+            m_capacity = newCapacity;
+        }
+
+        // Like reserve, but grows geometrically so that repeated small requests stay amortised O(1).
+        void ensureCapacity(Size minCapacity) {
+            if (minCapacity > m_capacity) {
+                resizeInternal(grownCapacity(minCapacity));
+            }
+        }
+
+        // Makes room for count elements at index and returns the first of the uninitialised slots.
+        T *openGap(Size index, Size count) {
+            if (m_size + count > m_capacity) {
+                Size newCapacity = grownCapacity(m_size + count);
+                T *newData = m_allocator.allocate(newCapacity);
+                Memory::relocate(newData, m_data, index);
+                Memory::relocate(newData + index + count, m_data + index, m_size - index);
+                releaseBuffer();
+                m_data = newData;
+                m_capacity = newCapacity;
+            } else {
+                Memory::relocate(m_data + index + count, m_data + index, m_size - index);
+            }
+            m_size += count;
+            return m_data + index;
+        }
+
+        // Whether an iterator range of type Candidate is a plain pointer range over T.
+        template<typename Candidate>
+        static constexpr Boolean isPointerRange() {
+            return TypeTraits::IsSame<Candidate, T *>::value || TypeTraits::IsSame<Candidate, const T *>::value;
+        }
+
+        // Copy-constructs count elements into uninitialised memory, with one memcpy for trivially copyable types.
+        void copyConstruct(T *target, const T *source, Size count) {
+            if constexpr (TypeTraits::IsTriviallyCopyable<T>::value) {
+                if (count != 0) {
+                    Memory::copy(target, source, count * sizeof(T));
+                }
+            } else {
+                for (Size i = 0; i < count; ++i) {
+                    m_allocator.construct(target + i, source[i]);
+                }
+            }
+        }
+
+        [[nodiscard]] Boolean overlaps(const T *values, Size count) const {
+            return values + count > m_data && values < m_data + m_size;
+        }
+
+        void destroyAll() {
             for (Size i = 0; i < m_size; ++i) {
-                m_allocator.construct(newData + i, TypeTraits::move(m_data[i]));
-                m_allocator.destroy(m_data.get() + i);
+                m_allocator.destroy(m_data + i);
             }
-            m_allocator.deallocate(m_data.release());
-            m_data.reset(newData);
-            m_capacity = newCapacity;
+            m_size = 0;
+        }
+
+        // Kept out of line so that the bounds check is all operator[] inlines.
+        [[noreturn]] static void throwOutOfRange() {
+            throw OutOfRangeException("Index out of range");
         }
 
     public:
-        ArrayList() : m_size(0), m_capacity(0) {}
+        ArrayList() : m_data(inlineData()), m_size(0), m_capacity(InlineCapacity) {}
 
-        explicit ArrayList(Size initialCapacity) : m_size(0), m_capacity(initialCapacity) {
-            m_data.reset(m_allocator.allocate(m_capacity));
+        explicit ArrayList(Size initialCapacity) : ArrayList() {
+            reserve(initialCapacity);
         }
 
-        ArrayList(const ArrayList &other) {
-            Threading::LockGuard<Threading::Mutex> lock(other.m_mtx);
-            m_capacity = other.m_capacity;
+        ArrayList(const ArrayList &other) : ArrayList() {
+            reserve(other.m_capacity);
+            copyConstruct(m_data, other.m_data, other.m_size);
             m_size = other.m_size;
-            m_data.reset(m_allocator.allocate(m_capacity));
-            for (Size i = 0; i < m_size; ++i) {
-                m_allocator.construct(m_data.get() + i, other.m_data[i]);
-            }
+        }
+
+        ArrayList(ArrayList &&other) noexcept {
+            takeFrom(other);
         }
 
         ArrayList &operator=(const ArrayList &other) {
             if (this != &other) {
-                Threading::LockGuard<Threading::Mutex> lock_this(m_mtx), lock_other(other.m_mtx);
-                T *newData = m_allocator.allocate(other.m_capacity);
-                for (Size i = 0; i < other.m_size; ++i) {
-                    m_allocator.construct(newData + i, other.m_data[i]);
-                }
-                m_allocator.deallocate(m_data.release());
-                m_data.reset(newData);
-                m_capacity = other.m_capacity;
-                m_size = other.m_size;
+                ArrayList copy(other);
+                *this = TypeTraits::move(copy);
             }
             return *this;
         }
 
-        ~ArrayList() {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
-            for (Size i = 0; i < m_size; ++i) {
-                m_allocator.destroy(m_data.get() + i);
+        ArrayList &operator=(ArrayList &&other) noexcept {
+            if (this != &other) {
+                destroyAll();
+                releaseBuffer();
+                takeFrom(other);
             }
-            m_allocator.deallocate(m_data.release());
+            return *this;
+        }
+
+        ~ArrayList() {
+            destroyAll();
+            releaseBuffer();
         }
 
         void append(const T &value) {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            emplace(value);
+        }
+
+        void append(T &&value) {
+            emplace(TypeTraits::move(value));
+        }
+
+        // Constructs an element in place at the end and returns it.
+        template<typename... Args>
+        T &emplace(Args &&... args) {
             if (m_size == m_capacity) {
-                resizeInternal(m_capacity == 0 ? 1 : m_capacity * 2);
+                // The new element is built before the old ones move, as args may refer to one of them.
+                Size newCapacity = grownCapacity(m_size + 1);
+                T *newData = m_allocator.allocate(newCapacity);
+                m_allocator.construct(newData + m_size, TypeTraits::forward<Args>(args)...);
+                Memory::relocate(newData, m_data, m_size);
+                releaseBuffer();
+                m_data = newData;
+                m_capacity = newCapacity;
+            } else {
+                m_allocator.construct(m_data + m_size, TypeTraits::forward<Args>(args)...);
             }
-            m_allocator.construct(m_data.get() + m_size++, value);
+            return m_data[m_size++];
         }
 
         Boolean remove(const T &value) {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             for (Size i = 0; i < m_size; i++) {
                 if (m_data[i] == value) {
                     removeAt(i);
@@ -112,66 +255,212 @@ namespace Cedar::Core::Container {
         }
 
         void insertAt(Size index, const T &value) {
+            emplaceAt(index, value);
+        }
+
+        void insertAt(Size index, T &&value) {
+            emplaceAt(index, TypeTraits::move(value));
+        }
+
+        // Constructs an element at index, shifting the later elements up by one, and returns it.
+        template<typename... Args>
+        T &emplaceAt(Size index, Args &&... args) {
             if (index > m_size) {
-                throw OutOfRangeException("Index out of range");
+                throwOutOfRange();
             }
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
-            if (m_size == m_capacity) {
-                resizeInternal(m_capacity == 0 ? 1 : m_capacity * 2);
+            T value(TypeTraits::forward<Args>(args)...);
+            T *slot = openGap(index, 1);
+            m_allocator.construct(slot, TypeTraits::move(value));
+            return *slot;
+        }
+
+        // Copies count elements from values into the list at index.
+        void insertRange(Size index, const T *values, Size count) {
+            if (index > m_size) {
+                throwOutOfRange();
+            }
+            if (count == 0) {
+                return;
             }
-            for (Size i = m_size; i > index; --i) {
-                m_allocator.construct(m_data.get() + i, TypeTraits::move(m_data[i - 1]));
-                m_allocator.destroy(m_data.get() + i - 1);
+            if (overlaps(values, count)) {
+                // The source would move while the gap opens, so insert from a copy instead.
+                ArrayList copy(count);
+                copy.appendRange(values, count);
+                insertRange(index, copy.m_data, count);
+                return;
+            }
+            copyConstruct(openGap(index, count), values, count);
+        }
+
+        // Copies count elements from values onto the end, growing at most once.
+        void appendRange(const T *values, Size count) {
+            insertRange(m_size, values, count);
+        }
+
+        // Copies the elements of [first, last) onto the end, growing at most once. The range is walked twice, so it
+        // must be a forward range. Pointer ranges go through appendRange(const T*, Size), which copies trivially
+        // copyable elements with one memcpy and may point into this list. Integral types never select this overload.
+        template<typename ForwardIterator,
+                 typename = typename TypeTraits::EnableIf<!TypeTraits::IsIntegral<ForwardIterator>::value>::Type>
+        void appendRange(ForwardIterator first, ForwardIterator last) {
+            if constexpr (isPointerRange<ForwardIterator>()) {
+                appendRange(static_cast<const T *>(first), static_cast<Size>(last - first));
+            } else {
+                Size count = 0;
+                for (ForwardIterator it = first; it != last; ++it) {
+                    ++count;
+                }
+                ensureCapacity(m_size + count);
+                for (; first != last; ++first) {
+                    m_allocator.construct(m_data + m_size++, *first);
+                }
+            }
+        }
+
+        // Replaces the contents with a copy of count elements from values, which may lie in this list.
+        void assign(const T *values, Size count) {
+            if (overlaps(values, count)) {
+                ArrayList copy(count);
+                copy.appendRange(values, count);
+                *this = TypeTraits::move(copy);
+                return;
+            }
+            destroyAll();
+            appendRange(values, count);
+        }
+
+        // Replaces the contents with a copy of the forward range [first, last), which may come from this list.
+        template<typename ForwardIterator,
+                 typename = typename TypeTraits::EnableIf<!TypeTraits::IsIntegral<ForwardIterator>::value>::Type>
+        void assign(ForwardIterator first, ForwardIterator last) {
+            if constexpr (isPointerRange<ForwardIterator>()) {
+                assign(static_cast<const T *>(first), static_cast<Size>(last - first));
+            } else {
+                // Other iterators may refer to elements that destroyAll() would destroy, so copy out first.
+                ArrayList copy;
+                copy.appendRange(first, last);
+                *this = TypeTraits::move(copy);
+            }
+        }
+
+        // Replaces the contents with count copies of value.
+        void assign(Size count, const T &value) {
+            T fill(value);
+            destroyAll();
+            resize(count, fill);
+        }
+
+        // Shrinks or grows to count elements; new elements are value-initialised, so numbers start at zero.
+        void resize(Size count) {
+            if (count <= m_size) {
+                truncate(count);
+                return;
+            }
+            ensureCapacity(count);
+            for (; m_size < count; ++m_size) {
+                m_allocator.construct(m_data + m_size);
+            }
+        }
+
+        // Shrinks or grows to count elements, filling new slots with copies of value.
+        void resize(Size count, const T &value) {
+            if (count <= m_size) {
+                truncate(count);
+                return;
+            }
+            T fill(value);
+            ensureCapacity(count);
+            for (; m_size < count; ++m_size) {
+                m_allocator.construct(m_data + m_size, fill);
+            }
+        }
+
+        // Like resize(count), but new elements are default-initialised, which leaves trivial types such as numbers
+        // uninitialised. Meant for buffers that are about to be overwritten.
+        void resizeUninitialized(Size count) {
+            if (count <= m_size) {
+                truncate(count);
+                return;
+            }
+            ensureCapacity(count);
+            for (; m_size < count; ++m_size) {
+                new (m_data + m_size) T;
+            }
+        }
+
+        // Destroys the elements from count onwards.
+        void truncate(Size count) {
+            for (Size i = count; i < m_size; ++i) {
+                m_allocator.destroy(m_data + i);
+            }
+            if (count < m_size) {
+                m_size = count;
             }
-            m_allocator.construct(m_data.get() + index, value);
-            ++m_size;
         }
 
         void removeAt(Size index) {
             if (index >= m_size) {
-                throw OutOfRangeException("Index out of range");
+                throwOutOfRange();
+            }
+            removeRange(index, 1);
+        }
+
+        // Removes count elements starting at index, shifting the later elements down.
+        void removeRange(Size index, Size count) {
+            if (index > m_size || count > m_size - index) {
+                throwOutOfRange();
             }
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
-            m_allocator.destroy(m_data.get() + index);
-            for (Size i = index; i < m_size - 1; ++i) {
-                m_allocator.construct(m_data.get() + i, TypeTraits::move(m_data[i + 1]));
-                m_allocator.destroy(m_data.get() + i + 1);
+            for (Size i = index; i < index + count; ++i) {
+                m_allocator.destroy(m_data + i);
             }
-            --m_size;
+            Memory::relocate(m_data + index, m_data + index + count, m_size - index - count);
+            m_size -= count;
         }
 
-        void clear() {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
-            for (Size i = 0; i < m_size; ++i) {
-                m_allocator.destroy(m_data.get() + i);
+        void reserve(Size capacity) {
+            if (capacity > m_capacity) {
+                resizeInternal(capacity);
+            }
+        }
+
+        // Releases the capacity beyond size().
+        void shrinkToFit() {
+            if (m_capacity > m_size) {
+                resizeInternal(m_size);
             }
-            m_allocator.deallocate(m_data.release());
-            m_data.reset(m_allocator.allocate(m_capacity));
-            m_size = 0;
+        }
+
+        // Destroys every element but keeps the buffer for reuse.
+        void clear() {
+            destroyAll();
         }
 
         [[nodiscard]] Size size() const {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             return m_size;
         }
 
+        [[nodiscard]] Size capacity() const {
+            return m_capacity;
+        }
+
+        [[nodiscard]] Boolean isEmpty() const {
+            return m_size == 0;
+        }
+
         [[nodiscard]] T *data() const {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
-            return m_data.get();
+            return m_data;
         }
 
         T &operator[](Size index) {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             if (index >= m_size) {
-                throw OutOfRangeException("Index out of range");
+                throwOutOfRange();
             }
             return m_data[index];
         }
 
         const T &operator[](Size index) const {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             if (index >= m_size) {
-                throw OutOfRangeException("Index out of range");
+                throwOutOfRange();
             }
             return m_data[index];
         }
@@ -211,12 +500,10 @@ namespace Cedar::Core::Container {
         };
 
         Iterator begin() {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             return Iterator(m_data);
         }
 
         Iterator end() {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             return Iterator(m_data + m_size);
         }
 
@@ -255,12 +542,10 @@ namespace Cedar::Core::Container {
         };
 
         ConstIterator begin() const {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             return ConstIterator(m_data);
         }
 
         ConstIterator end() const {
-            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
             return ConstIterator(m_data + m_size);
         }
     };
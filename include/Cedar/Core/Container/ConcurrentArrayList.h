@@ -0,0 +1,113 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Container/ArrayList.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+
+namespace Cedar::Core::Container {
+    // ArrayList guarded by a Mutex, for lists that several threads mutate. Elements are returned by value because a
+    // reference could be invalidated by another thread's append; use forEach or snapshot to visit them in place.
+    template<typename T>
+    class ConcurrentArrayList {
+    public:
+        ConcurrentArrayList() = default;
+
+        explicit ConcurrentArrayList(Size initialCapacity) : m_list(initialCapacity) {}
+
+        ConcurrentArrayList(const ConcurrentArrayList&) = delete;
+        ConcurrentArrayList& operator=(const ConcurrentArrayList&) = delete;
+
+        void append(const T& value) {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            m_list.append(value);
+        }
+
+        void append(T&& value) {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            m_list.append(TypeTraits::move(value));
+        }
+
+        // Appends count elements under a single lock acquisition.
+        void appendRange(const T* values, Size count) {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            m_list.appendRange(values, count);
+        }
+
+        void insertAt(Size index, const T& value) {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            m_list.insertAt(index, value);
+        }
+
+        Boolean remove(const T& value) {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            return m_list.remove(value);
+        }
+
+        void removeAt(Size index) {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            m_list.removeAt(index);
+        }
+
+        void clear() {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            m_list.clear();
+        }
+
+        [[nodiscard]] T get(Size index) const {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            return m_list[index];
+        }
+
+        void set(Size index, const T& value) {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            m_list[index] = value;
+        }
+
+        [[nodiscard]] Size size() const {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            return m_list.size();
+        }
+
+        // Calls visitor on every element while holding the lock, so the visitor must not use this list.
+        template<typename Visitor>
+        void forEach(Visitor visitor) const {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            for (const T& value : m_list) {
+                visitor(value);
+            }
+        }
+
+        [[nodiscard]] ArrayList<T> snapshot() const {
+            Threading::LockGuard<Threading::Mutex> lock(m_mtx);
+            return m_list;
+        }
+
+    private:
+        ArrayList<T> m_list;
+        mutable Threading::Mutex m_mtx;
+    };
+}
@@ -0,0 +1,306 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Hashing.h>
+#include <Cedar/Core/Threading/Epoch.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+
+#include <atomic>
+
+namespace Cedar::Core::Container {
+    // Hash map shared between threads.
+    //
+    // Lookups take no locks: they walk immutable nodes under an Epoch::Guard, and replaced or removed nodes are
+    // retired through Threading::Epoch. Writers lock one of StripeCount stripes, chosen by the key's hash. Bucket
+    // counts are always multiples of StripeCount, so a key keeps its stripe across resizes.
+    //
+    // Growing is incremental: a new table is attached to the current one and writers each move a few buckets
+    // across, leaving a forwarding marker behind, until the old table is empty and gets retired.
+    template<typename KeyType, typename ValueType>
+    class ConcurrentHashMap {
+    public:
+        explicit ConcurrentHashMap(Size initialCapacity = 0) {
+            Size capacity = MinBuckets;
+            while (capacity < initialCapacity) {
+                capacity *= 2;
+            }
+            m_table.store(new Table(capacity), std::memory_order_release);
+        }
+
+        ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+        ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+        // Must not race with any other operation on the map.
+        ~ConcurrentHashMap() {
+            Table* table = m_table.load(std::memory_order_acquire);
+            while (table) {
+                for (Size i = 0; i < table->capacity; ++i) {
+                    Node* node = table->buckets[i].load(std::memory_order_relaxed);
+                    if (node == moved()) continue;
+                    while (node) {
+                        Node* next = node->next.load(std::memory_order_relaxed);
+                        delete node;
+                        node = next;
+                    }
+                }
+                Table* next = table->next.load(std::memory_order_relaxed);
+                delete table;
+                table = next;
+            }
+        }
+
+        // Inserts key or replaces its value; returns true if the key was not present before.
+        Boolean insert(const KeyType& key, const ValueType& value) {
+            Threading::Epoch::Guard guard;
+            Hash keyHash = hashOf(key);
+            Stripe& stripe = stripeFor(keyHash);
+            Table* table = nullptr;
+            std::atomic<Node*>* bucket = lockBucket(keyHash, table);
+
+            Boolean inserted = true;
+            std::atomic<Node*>* link = bucket;
+            for (Node* node = link->load(std::memory_order_relaxed); node; node = link->load(std::memory_order_relaxed)) {
+                if (node->hash == keyHash && node->key == key) {
+                    link->store(new Node(keyHash, key, value, node->next.load(std::memory_order_relaxed)), std::memory_order_release);
+                    Threading::Epoch::retire(node, deleteNode);
+                    inserted = false;
+                    break;
+                }
+                link = &node->next;
+            }
+            if (inserted) {
+                bucket->store(new Node(keyHash, key, value, bucket->load(std::memory_order_relaxed)), std::memory_order_release);
+                stripe.count.fetch_add(1, std::memory_order_relaxed);
+            }
+            Boolean crowded = stripe.count.load(std::memory_order_relaxed) > table->capacity / StripeCount;
+            stripe.lock.unlock();
+
+            if (inserted && crowded) {
+                grow(table);
+            }
+            return inserted;
+        }
+
+        // Copies the value stored for key into value; returns false if the key is absent.
+        Boolean find(const KeyType& key, ValueType& value) const {
+            Threading::Epoch::Guard guard;
+            const Node* node = lookup(key);
+            if (!node) return false;
+            value = node->value;
+            return true;
+        }
+
+        [[nodiscard]] Boolean contains(const KeyType& key) const {
+            Threading::Epoch::Guard guard;
+            return lookup(key) != nullptr;
+        }
+
+        Boolean remove(const KeyType& key) {
+            Threading::Epoch::Guard guard;
+            Hash keyHash = hashOf(key);
+            Stripe& stripe = stripeFor(keyHash);
+            Table* table = nullptr;
+            std::atomic<Node*>* link = lockBucket(keyHash, table);
+
+            Boolean removed = false;
+            for (Node* node = link->load(std::memory_order_relaxed); node; node = link->load(std::memory_order_relaxed)) {
+                if (node->hash == keyHash && node->key == key) {
+                    link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+                    Threading::Epoch::retire(node, deleteNode);
+                    stripe.count.fetch_sub(1, std::memory_order_relaxed);
+                    removed = true;
+                    break;
+                }
+                link = &node->next;
+            }
+            stripe.lock.unlock();
+            return removed;
+        }
+
+        // Number of entries; only a snapshot while other threads are writing.
+        [[nodiscard]] Size size() const {
+            Size total = 0;
+            for (const Stripe& stripe : m_stripes) {
+                total += stripe.count.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+    private:
+        static constexpr Size StripeCount = 64;
+        static constexpr Size MinBuckets = StripeCount * 4;
+
+        // Buckets handed to a writer each time it helps move entries into a larger table.
+        static constexpr Size MigrationChunk = 64;
+
+        struct Node {
+            const Hash hash;
+            const KeyType key;
+            const ValueType value;
+            std::atomic<Node*> next;
+
+            Node(Hash hash, const KeyType& key, const ValueType& value, Node* next)
+                    : hash(hash), key(key), value(value), next(next) {}
+        };
+
+        struct Table {
+            const Size capacity;
+            std::atomic<Node*>* const buckets;
+            std::atomic<Table*> next{nullptr};          // Larger table being filled from this one, if any
+            std::atomic<Size> migrateCursor{0};         // First bucket not yet claimed for migration
+            std::atomic<Size> migrated{0};              // Buckets already forwarded to next
+
+            explicit Table(Size capacity) : capacity(capacity), buckets(new std::atomic<Node*>[capacity]) {
+                for (Size i = 0; i < capacity; ++i) {
+                    buckets[i].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            ~Table() {
+                delete[] buckets;
+            }
+        };
+
+        struct alignas(64) Stripe {
+            Threading::Mutex lock;
+            std::atomic<Size> count{0};
+        };
+
+        std::atomic<Table*> m_table;
+        Stripe m_stripes[StripeCount];
+
+        // Stored in a migrated bucket of the old table; never dereferenced.
+        static Node* moved() {
+            static Byte marker;
+            return reinterpret_cast<Node*>(&marker);
+        }
+
+        static void deleteNode(Pointer node) {
+            delete static_cast<Node*>(node);
+        }
+
+        static void deleteTable(Pointer table) {
+            delete static_cast<Table*>(table);
+        }
+
+        static Hash hashOf(const KeyType& key) {
+            return KeyHash<KeyType>()(key);
+        }
+
+        Stripe& stripeFor(Hash keyHash) {
+            return m_stripes[keyHash & (StripeCount - 1)];
+        }
+
+        const Node* lookup(const KeyType& key) const {
+            Hash keyHash = hashOf(key);
+            Table* table = m_table.load(std::memory_order_acquire);
+            while (true) {
+                Node* node = table->buckets[keyHash & (table->capacity - 1)].load(std::memory_order_acquire);
+                if (node == moved()) {
+                    table = table->next.load(std::memory_order_acquire);
+                    continue;
+                }
+                for (; node; node = node->next.load(std::memory_order_acquire)) {
+                    if (node->hash == keyHash && node->key == key) {
+                        return node;
+                    }
+                }
+                return nullptr;
+            }
+        }
+
+        // Locks the stripe for keyHash and returns the live bucket for it, following forwarded buckets; table is set to
+        // the table that owns the bucket. The caller unlocks the stripe.
+        std::atomic<Node*>* lockBucket(Hash keyHash, Table*& table) {
+            Stripe& stripe = stripeFor(keyHash);
+            table = m_table.load(std::memory_order_acquire);
+            if (table->next.load(std::memory_order_acquire)) {
+                helpMigrate(table);
+            }
+
+            stripe.lock.lock();
+            while (true) {
+                std::atomic<Node*>* bucket = &table->buckets[keyHash & (table->capacity - 1)];
+                if (bucket->load(std::memory_order_relaxed) != moved()) {
+                    return bucket;
+                }
+                table = table->next.load(std::memory_order_acquire);
+            }
+        }
+
+        void grow(Table* table) {
+            if (table != m_table.load(std::memory_order_acquire)) return;
+
+            auto* grown = new Table(table->capacity * 2);
+            Table* expected = nullptr;
+            if (!table->next.compare_exchange_strong(expected, grown, std::memory_order_acq_rel)) {
+                delete grown;
+            }
+            helpMigrate(table);
+        }
+
+        // Claims the next chunk of buckets in table and moves them into its successor.
+        void helpMigrate(Table* table) {
+            Size start = table->migrateCursor.fetch_add(MigrationChunk, std::memory_order_relaxed);
+            if (start >= table->capacity) return;
+
+            Size end = start + MigrationChunk < table->capacity ? start + MigrationChunk : table->capacity;
+            Table* next = table->next.load(std::memory_order_acquire);
+            for (Size i = start; i < end; ++i) {
+                migrateBucket(table, next, i);
+            }
+
+            if (table->migrated.fetch_add(end - start, std::memory_order_acq_rel) + (end - start) == table->capacity) {
+                m_table.store(next, std::memory_order_release);
+                Threading::Epoch::retire(table, deleteTable);
+            }
+        }
+
+        // Readers may still be walking the old chain, so its nodes are copied rather than relinked.
+        void migrateBucket(Table* table, Table* next, Size index) {
+            Threading::LockGuard<Threading::Mutex> lock(m_stripes[index & (StripeCount - 1)].lock);
+
+            Node* low = nullptr;
+            Node* high = nullptr;
+            Node* node = table->buckets[index].load(std::memory_order_relaxed);
+            for (Node* current = node; current; current = current->next.load(std::memory_order_relaxed)) {
+                Node*& chain = (current->hash & table->capacity) ? high : low;
+                chain = new Node(current->hash, current->key, current->value, chain);
+            }
+
+            next->buckets[index].store(low, std::memory_order_release);
+            next->buckets[index + table->capacity].store(high, std::memory_order_release);
+            table->buckets[index].store(moved(), std::memory_order_release);
+
+            while (node) {
+                Node* following = node->next.load(std::memory_order_relaxed);
+                Threading::Epoch::retire(node, deleteNode);
+                node = following;
+            }
+        }
+    };
+}
@@ -0,0 +1,198 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/TypeTraits.h>
+#include <Cedar/Core/Exceptions/OutOfMemoryException.h>
+
+#include <atomic>
+
+namespace Cedar::Core::Container {
+    // Lock-free LIFO stack (Treiber). Nodes live in segments owned by the stack and are named by 32-bit ids, so a list
+    // head packs an id and a 32-bit tag into one 64-bit word. Every successful exchange bumps the tag, which defeats
+    // ABA, and a node that a slow thread may still be reading is never freed, only recycled. Popped nodes go to one of
+    // several free lists picked per thread, so recycling is spread over several heads instead of contending on one.
+    template<typename T>
+    class ConcurrentStack {
+    public:
+        ConcurrentStack() = default;
+
+        ~ConcurrentStack() {
+            for (UInt32 id = idOf(m_top.word.load(std::memory_order_relaxed)); id != 0;
+                 id = node(id).next.load(std::memory_order_relaxed)) {
+                node(id).value()->~T();
+            }
+            for (auto& segment : m_segments) {
+                delete[] segment.load(std::memory_order_relaxed);
+            }
+        }
+
+        ConcurrentStack(const ConcurrentStack&) = delete;
+        ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+        void push(const T& value) {
+            emplace(value);
+        }
+
+        void push(T&& value) {
+            emplace(TypeTraits::move(value));
+        }
+
+        template<typename... Args>
+        void emplace(Args&&... args) {
+            UInt32 id = acquireNode();
+            new (node(id).value()) T(TypeTraits::forward<Args>(args)...);
+            pushNode(m_top, id);
+        }
+
+        Boolean tryPop(T& out) {
+            UInt32 id = popNode(m_top);
+            if (id == 0) {
+                return false;
+            }
+            T* value = node(id).value();
+            out = TypeTraits::move(*value);
+            value->~T();
+            pushNode(m_free[freeListForThisThread()], id);
+            return true;
+        }
+
+        // Only a snapshot while other threads are pushing or popping.
+        [[nodiscard]] Boolean isEmpty() const {
+            return idOf(m_top.word.load(std::memory_order_acquire)) == 0;
+        }
+
+    private:
+        // Segment k holds FirstSegmentSize << k nodes; 27 segments cover every 32-bit id.
+        static constexpr Size FirstSegmentShift = 6;
+        static constexpr Size FirstSegmentSize = Size(1) << FirstSegmentShift;
+        static constexpr Size SegmentCount = 27;
+        static constexpr UInt32 FreeListCount = 8;
+
+        struct Node {
+            alignas(T) Byte storage[sizeof(T)];
+            std::atomic<UInt32> next{0};    // Atomic because a losing popper may read it while the node is reused
+
+            T* value() {
+                return reinterpret_cast<T*>(storage);
+            }
+        };
+
+        // Each head on its own cache line. The word holds the tag in the high half and the node id, 0 for none, below.
+        struct alignas(64) Head {
+            std::atomic<UInt64> word{0};
+        };
+
+        Head m_top;
+        Head m_free[FreeListCount];
+        std::atomic<Node*> m_segments[SegmentCount]{};
+        std::atomic<UInt32> m_allocated{0};
+
+        static UInt32 idOf(UInt64 word) {
+            return static_cast<UInt32>(word);
+        }
+
+        static UInt64 retag(UInt64 word, UInt32 id) {
+            return ((word >> 32) + 1) << 32 | id;
+        }
+
+        static Size segmentOf(UInt32 id, Size& offset) {
+            Size block = ((id - 1) >> FirstSegmentShift) + 1;
+#if defined(__GNUC__) || defined(__clang__)
+            auto segment = static_cast<Size>(63 - __builtin_clzll(block));
+#else
+            Size segment = 0;
+            while (block >> (segment + 1)) {
+                ++segment;
+            }
+#endif
+            offset = (id - 1) + FirstSegmentSize - (FirstSegmentSize << segment);
+            return segment;
+        }
+
+        Node& node(UInt32 id) const {
+            Size offset;
+            Size segment = segmentOf(id, offset);
+            return m_segments[segment].load(std::memory_order_acquire)[offset];
+        }
+
+        static UInt32 freeListForThisThread() {
+            static std::atomic<UInt32> nextFreeList{0};
+            // Constant-initialised and assigned on first use, which keeps the thread_local access a plain load.
+            static thread_local UInt32 freeList = FreeListCount;
+            if (freeList == FreeListCount) {
+                freeList = nextFreeList.fetch_add(1, std::memory_order_relaxed) % FreeListCount;
+            }
+            return freeList;
+        }
+
+        void pushNode(Head& head, UInt32 id) {
+            Node& pushed = node(id);
+            UInt64 old = head.word.load(std::memory_order_relaxed);
+            do {
+                pushed.next.store(idOf(old), std::memory_order_relaxed);
+            } while (!head.word.compare_exchange_weak(old, retag(old, id), std::memory_order_release,
+                                                      std::memory_order_relaxed));
+        }
+
+        UInt32 popNode(Head& head) {
+            UInt64 old = head.word.load(std::memory_order_acquire);
+            while (idOf(old) != 0) {
+                UInt32 next = node(idOf(old)).next.load(std::memory_order_relaxed);
+                if (head.word.compare_exchange_weak(old, retag(old, next), std::memory_order_acquire,
+                                                    std::memory_order_acquire)) {
+                    return idOf(old);
+                }
+            }
+            return 0;
+        }
+
+        // Takes a recycled node, preferring this thread's free list, or carves a new one out of the segments.
+        UInt32 acquireNode() {
+            UInt32 first = freeListForThisThread();
+            for (UInt32 i = 0; i < FreeListCount; ++i) {
+                UInt32 id = popNode(m_free[(first + i) % FreeListCount]);
+                if (id != 0) {
+                    return id;
+                }
+            }
+
+            UInt32 id = m_allocated.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (id == 0) {
+                throw OutOfMemoryException("ConcurrentStack has run out of node ids");
+            }
+            Size offset;
+            Size segment = segmentOf(id, offset);
+            if (!m_segments[segment].load(std::memory_order_acquire)) {
+                Node* nodes = new Node[FirstSegmentSize << segment];
+                Node* expected = nullptr;
+                if (!m_segments[segment].compare_exchange_strong(expected, nodes, std::memory_order_acq_rel)) {
+                    delete[] nodes;
+                }
+            }
+            return id;
+        }
+    };
+}
@@ -24,182 +24,119 @@
 #pragma once
 
 #include <Cedar/Core/BasicTypes.h>
-#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Container/HashTable.h>
 #include <Cedar/Core/Container/Pair.h>
 
 #include <initializer_list>
 
 namespace Cedar::Core::Container {
-    template<typename KeyType, typename ValueType>
-    class HashNode {
-    public:
-        KeyType key;
-        ValueType value;
-        HashNode *next;
-
-        HashNode(const KeyType &key, const ValueType &value) : key(key), value(value), next(nullptr) {}
-    };
-
-    template<typename KeyType, typename ValueType, Size TableSize = 256>
+    // Growable open-addressing map. InitialCapacity is the number of entries to reserve room for up front.
+    // Not synchronised; pointers returned by find() and operator[] are invalidated by the next insertion.
+    template<typename KeyType, typename ValueType, Size InitialCapacity = 0>
     class HashMap {
     private:
-        HashNode<KeyType, ValueType> *buckets[TableSize];
-        Threading::Mutex locks[TableSize];
+        struct Entry {
+            KeyType key;
+            ValueType value;
 
-        Hash myHash(const KeyType &key) const {
-            return hash<KeyType>(key) % TableSize;
-        }
+            template<typename... Args>
+            explicit Entry(const KeyType& key, Args&&... args) : key(key), value(TypeTraits::forward<Args>(args)...) {}
+        };
 
-    public:
-        HashMap() {
-            for (Size i = 0; i < TableSize; ++i) {
-                buckets[i] = nullptr;
+        struct KeyOfEntry {
+            static const KeyType& get(const Entry& entry) {
+                return entry.key;
             }
-        }
+        };
+
+        using Table = HashTable<KeyType, Entry, KeyOfEntry>;
+
+        Table m_table;
+
+    public:
+        HashMap() : m_table(InitialCapacity) {}
 
         HashMap(std::initializer_list<Pair<const KeyType, ValueType>> list) : HashMap() {
+            reserve(list.size());
             for (const auto &element: list) {
                 insert(element.first, element.second);
             }
         }
 
-        ~HashMap() {
-            clear();
-        }
-
+        // Inserts key, or replaces the value already stored for it.
         void insert(const KeyType &key, const ValueType &value) {
-            Size index = myHash(key);
-            HashNode<KeyType, ValueType> *newNode = new HashNode<KeyType, ValueType>(key, value);
-            locks[index].lock();
-            HashNode<KeyType, ValueType> *node = buckets[index];
-            if (node == nullptr) {
-                buckets[index] = newNode;
-            } else {
-                while (node->next != nullptr) {
-                    node = node->next;
-                }
-                node->next = newNode;
+            auto result = m_table.emplace(key, key, value);
+            if (!result.second) {
+                result.first->value = value;
             }
-            locks[index].unlock();
         }
 
         ValueType *find(const KeyType &key) const {
-            Size index = myHash(key);
-            locks[index].lock();
-            HashNode<KeyType, ValueType> *node = buckets[index];
-            while (node != nullptr) {
-                if (node->key == key) {
-                    locks[index].unlock();
-                    return &node->value;
-                }
-                node = node->next;
-            }
-            locks[index].unlock();
-            return nullptr;
+            Entry *entry = m_table.find(key);
+            return entry ? &entry->value : nullptr;
+        }
+
+        [[nodiscard]] Boolean contains(const KeyType &key) const {
+            return m_table.find(key) != nullptr;
         }
 
         Boolean remove(const KeyType &key) {
-            Size index = myHash(key);
-            locks[index].lock();
-            HashNode<KeyType, ValueType> *node = buckets[index];
-            HashNode<KeyType, ValueType> *prev = nullptr;
-            while (node != nullptr) {
-                if (node->key == key) {
-                    if (prev == nullptr) {
-                        buckets[index] = node->next;
-                    } else {
-                        prev->next = node->next;
-                    }
-                    delete node;
-                    locks[index].unlock();
-                    return true;
-                }
-                prev = node;
-                node = node->next;
-            }
-            locks[index].unlock();
-            return false;
+            return m_table.erase(key);
         }
 
         void clear() {
-            for (Size i = 0; i < TableSize; ++i) {
-                locks[i].lock();
-                HashNode<KeyType, ValueType> *node = buckets[i];
-                while (node != nullptr) {
-                    HashNode<KeyType, ValueType> *next = node->next;
-                    delete node;
-                    node = next;
-                }
-                buckets[i] = nullptr;
-                locks[i].unlock();
-            }
+            m_table.clear();
         }
 
-        ValueType &operator[](const KeyType &key) {
-            Size index = myHash(key);
-            HashNode<KeyType, ValueType> *node = buckets[index];
-
-            while (node != nullptr) {
-                if (node->key == key) {
-                    return node->value;
-                }
-                node = node->next;
-            }
+        void reserve(Size count) {
+            m_table.reserve(count);
+        }
 
-            auto *newNode = new HashNode<KeyType, ValueType>(key, ValueType());
-            newNode->next = buckets[index];
-            buckets[index] = newNode;
-            return newNode->value;
+        [[nodiscard]] Size size() const {
+            return m_table.size();
+        }
+
+        [[nodiscard]] Boolean isEmpty() const {
+            return m_table.size() == 0;
+        }
+
+        ValueType &operator[](const KeyType &key) {
+            return m_table.emplace(key, key).first->value;
         }
 
         class Iterator {
         private:
-            HashNode<KeyType, ValueType> **buckets;
-            HashNode<KeyType, ValueType> *current;
-            Size bucketIndex;
-            Size tableSize;
+            const Table *table;
+            Size index;
 
         public:
-            Iterator(HashNode<KeyType, ValueType> **buckets, Size index, Size tableSize, Boolean end = false)
-                    : buckets(buckets), bucketIndex(index), tableSize(tableSize), current(nullptr) {
-                if (!end) {
-                    while (bucketIndex < tableSize && !buckets[bucketIndex]) {
-                        bucketIndex++;
-                    }
-                    if (bucketIndex < tableSize) {
-                        current = buckets[bucketIndex];
-                    }
-                }
-            }
+            Iterator(const Table *table, Size index) : table(table), index(table->nextOccupied(index)) {}
 
             Iterator &operator++() {
-                if (current && current->next) {
-                    current = current->next;
-                } else {
-                    do {
-                        bucketIndex++;
-                    } while (bucketIndex < tableSize && !buckets[bucketIndex]);
-
-                    current = (bucketIndex < tableSize) ? buckets[bucketIndex] : nullptr;
-                }
+                index = table->nextOccupied(index + 1);
                 return *this;
             }
 
             Pair<const KeyType &, ValueType &> operator*() const {
-                return Pair<const KeyType &, ValueType &>(current->key, current->value);
+                Entry &entry = table->slotAt(index);
+                return Pair<const KeyType &, ValueType &>(entry.key, entry.value);
+            }
+
+            Boolean operator==(const Iterator &other) const {
+                return index == other.index;
             }
 
             Boolean operator!=(const Iterator &other) const {
-                return current != other.current;
+                return index != other.index;
             }
         };
 
         Iterator begin() const {
-            return Iterator(buckets, 0, TableSize);
+            return Iterator(&m_table, 0);
         }
 
         Iterator end() const {
-            return Iterator(buckets, TableSize, TableSize, true);
+            return Iterator(&m_table, m_table.capacity());
         }
     };
 }
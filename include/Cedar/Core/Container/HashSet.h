@@ -21,4 +21,143 @@
  * SOFTWARE.
  */
 
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Container/HashTable.h>
+
+#include <initializer_list>
+
+namespace Cedar::Core::Container {
+    // Growable open-addressing set storing each element once in the slot array, with no per-entry allocation.
+    // InitialCapacity is the number of elements to reserve room for up front. Not synchronised.
+    template<typename T, Size InitialCapacity = 0>
+    class HashSet {
+    private:
+        struct Identity {
+            static const T& get(const T& element) {
+                return element;
+            }
+        };
+
+        using Table = HashTable<T, T, Identity>;
+
+        // How many keys ahead the batched operations hash and prefetch.
+        static constexpr Size PrefetchDistance = 8;
+
+        Table m_table;
+
+    public:
+        HashSet() : m_table(InitialCapacity) {}
+
+        HashSet(std::initializer_list<T> list) : HashSet() {
+            reserve(list.size());
+            for (const auto& element: list) {
+                insert(element);
+            }
+        }
+
+        // Returns false if the element was already present.
+        Boolean insert(const T& element) {
+            return m_table.emplace(element, element).second;
+        }
+
+        [[nodiscard]] Boolean contains(const T& element) const {
+            return m_table.find(element) != nullptr;
+        }
+
+        Boolean remove(const T& element) {
+            return m_table.erase(element);
+        }
+
+        // Sets results[i] to whether keys[i] is present. Hashes run PrefetchDistance keys ahead of the probes so
+        // the control bytes and slots of later keys are already on their way from memory.
+        void containsMany(const T* keys, Size count, Boolean* results) const {
+            Hash hashes[PrefetchDistance];
+            Size primed = count < PrefetchDistance ? count : PrefetchDistance;
+            for (Size i = 0; i < primed; ++i) {
+                hashes[i] = m_table.hashOf(keys[i]);
+                m_table.prefetch(hashes[i]);
+            }
+            for (Size i = 0; i < count; ++i) {
+                Hash keyHash = hashes[i % PrefetchDistance];
+                if (i + PrefetchDistance < count) {
+                    hashes[i % PrefetchDistance] = m_table.hashOf(keys[i + PrefetchDistance]);
+                    m_table.prefetch(hashes[i % PrefetchDistance]);
+                }
+                results[i] = m_table.find(keys[i], keyHash) != nullptr;
+            }
+        }
+
+        // Inserts keys[0..count) with the same look-ahead as containsMany and returns how many were new.
+        // A rehash part-way through only makes the outstanding prefetches useless, never wrong.
+        Size insertMany(const T* keys, Size count) {
+            Hash hashes[PrefetchDistance];
+            Size primed = count < PrefetchDistance ? count : PrefetchDistance;
+            for (Size i = 0; i < primed; ++i) {
+                hashes[i] = m_table.hashOf(keys[i]);
+                m_table.prefetch(hashes[i]);
+            }
+            Size inserted = 0;
+            for (Size i = 0; i < count; ++i) {
+                Hash keyHash = hashes[i % PrefetchDistance];
+                if (i + PrefetchDistance < count) {
+                    hashes[i % PrefetchDistance] = m_table.hashOf(keys[i + PrefetchDistance]);
+                    m_table.prefetch(hashes[i % PrefetchDistance]);
+                }
+                inserted += m_table.emplaceHashed(keys[i], keyHash, keys[i]).second;
+            }
+            return inserted;
+        }
+
+        void clear() {
+            m_table.clear();
+        }
+
+        void reserve(Size count) {
+            m_table.reserve(count);
+        }
+
+        [[nodiscard]] Size size() const {
+            return m_table.size();
+        }
+
+        [[nodiscard]] Boolean isEmpty() const {
+            return m_table.size() == 0;
+        }
+
+        class Iterator {
+        private:
+            const Table* table;
+            Size index;
+
+        public:
+            Iterator(const Table* table, Size index) : table(table), index(table->nextOccupied(index)) {}
+
+            Iterator& operator++() {
+                index = table->nextOccupied(index + 1);
+                return *this;
+            }
+
+            const T& operator*() const {
+                return table->slotAt(index);
+            }
+
+            Boolean operator==(const Iterator& other) const {
+                return index == other.index;
+            }
+
+            Boolean operator!=(const Iterator& other) const {
+                return index != other.index;
+            }
+        };
+
+        Iterator begin() const {
+            return Iterator(&m_table, 0);
+        }
+
+        Iterator end() const {
+            return Iterator(&m_table, m_table.capacity());
+        }
+    };
+}
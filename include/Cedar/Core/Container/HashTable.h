@@ -0,0 +1,385 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Hashing.h>
+#include <Cedar/Core/Memory.h>
+#include <Cedar/Core/Container/Pair.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CEDAR_HASH_TABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Cedar::Core::Container {
+    // Non-template part of HashTable: control byte encoding and group matching.
+    class HashTableBase {
+    protected:
+        // A full slot's control byte holds the low 7 bits of its hash; free slots have the top bit set.
+        static constexpr Int8 Empty = -128;
+        static constexpr Int8 Deleted = -2;
+
+        // Probing inspects this many control bytes at once.
+        static constexpr Size GroupWidth = 16;
+        static constexpr Size MinCapacity = GroupWidth;
+
+        // Matches over GroupWidth consecutive control bytes, one result bit per slot.
+        class Group {
+        public:
+            explicit Group(const Int8* control) {
+#ifdef CEDAR_HASH_TABLE_SSE2
+                m_control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+#else
+                m_control = control;
+#endif
+            }
+
+            UInt32 match(Int8 value) const {
+#ifdef CEDAR_HASH_TABLE_SSE2
+                return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), m_control)));
+#else
+                UInt32 bits = 0;
+                for (Size i = 0; i < GroupWidth; ++i) {
+                    bits |= static_cast<UInt32>(m_control[i] == value) << i;
+                }
+                return bits;
+#endif
+            }
+
+            UInt32 matchEmpty() const {
+                return match(Empty);
+            }
+
+            // Empty or deleted slots.
+            UInt32 matchFree() const {
+#ifdef CEDAR_HASH_TABLE_SSE2
+                return static_cast<UInt32>(_mm_movemask_epi8(m_control));
+#else
+                UInt32 bits = 0;
+                for (Size i = 0; i < GroupWidth; ++i) {
+                    bits |= static_cast<UInt32>(m_control[i] < 0) << i;
+                }
+                return bits;
+#endif
+            }
+
+        private:
+#ifdef CEDAR_HASH_TABLE_SSE2
+            __m128i m_control;
+#else
+            const Int8* m_control;
+#endif
+        };
+
+        static UInt32 lowestBit(UInt32 bits) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<UInt32>(__builtin_ctz(bits));
+#else
+            UInt32 index = 0;
+            while (!(bits & 1)) {
+                bits >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        // Tables are kept at most 7/8 full so that every probe sequence reaches an empty slot.
+        static Size maxLoadFor(Size capacity) {
+            return capacity - capacity / 8;
+        }
+
+        static Size capacityFor(Size count) {
+            Size capacity = MinCapacity;
+            while (maxLoadFor(capacity) < count) {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+    };
+
+    // Open-addressing hash table with SwissTable-style control bytes, shared by HashMap and HashSet.
+    // Keys are hashed with KeyHash; the low 7 bits become the control tag and the rest pick the first group to probe.
+    // Entries live contiguously in one slot array; KeyOf::get(entry) returns the key stored in an entry.
+    template<typename KeyType, typename EntryType, typename KeyOf>
+    class HashTable : private HashTableBase {
+    public:
+        HashTable() : m_control(nullptr), m_slots(nullptr), m_capacity(0), m_size(0), m_growthLeft(0) {}
+
+        explicit HashTable(Size capacityHint) : HashTable() {
+            reserve(capacityHint);
+        }
+
+        HashTable(const HashTable& other) : HashTable() {
+            copyFrom(other);
+        }
+
+        HashTable(HashTable&& other) noexcept
+                : m_control(other.m_control), m_slots(other.m_slots), m_capacity(other.m_capacity),
+                  m_size(other.m_size), m_growthLeft(other.m_growthLeft) {
+            other.m_control = nullptr;
+            other.m_slots = nullptr;
+            other.m_capacity = 0;
+            other.m_size = 0;
+            other.m_growthLeft = 0;
+        }
+
+        HashTable& operator=(const HashTable& other) {
+            if (this != &other) {
+                destroy();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        HashTable& operator=(HashTable&& other) noexcept {
+            if (this != &other) {
+                destroy();
+                m_control = other.m_control;
+                m_slots = other.m_slots;
+                m_capacity = other.m_capacity;
+                m_size = other.m_size;
+                m_growthLeft = other.m_growthLeft;
+                other.m_control = nullptr;
+                other.m_slots = nullptr;
+                other.m_capacity = 0;
+                other.m_size = 0;
+                other.m_growthLeft = 0;
+            }
+            return *this;
+        }
+
+        ~HashTable() {
+            destroy();
+        }
+
+        [[nodiscard]] Size size() const {
+            return m_size;
+        }
+
+        [[nodiscard]] Size capacity() const {
+            return m_capacity;
+        }
+
+        // Makes room for count entries without further rehashing.
+        void reserve(Size count) {
+            if (count > m_size + m_growthLeft) {
+                rehash(capacityFor(count));
+            }
+        }
+
+        void clear() {
+            if (m_capacity == 0) return;
+
+            for (Size i = 0; i < m_capacity; ++i) {
+                if (m_control[i] >= 0) {
+                    m_allocator.destroy(m_slots + i);
+                }
+            }
+            fillControl(Empty);
+            m_size = 0;
+            m_growthLeft = maxLoadFor(m_capacity);
+        }
+
+        [[nodiscard]] Hash hashOf(const KeyType& key) const {
+            return KeyHash<KeyType>()(key);
+        }
+
+        EntryType* find(const KeyType& key) const {
+            return find(key, hashOf(key));
+        }
+
+        EntryType* find(const KeyType& key, Hash keyHash) const {
+            if (m_size == 0) return nullptr;
+
+            Size mask = m_capacity - 1;
+            Size position = (keyHash >> 7) & mask;
+            Int8 tag = static_cast<Int8>(keyHash & 0x7F);
+            for (Size step = GroupWidth;; step += GroupWidth) {
+                Group group(m_control + position);
+                for (UInt32 bits = group.match(tag); bits; bits &= bits - 1) {
+                    Size index = (position + lowestBit(bits)) & mask;
+                    if (KeyOf::get(m_slots[index]) == key) {
+                        return m_slots + index;
+                    }
+                }
+                if (group.matchEmpty()) return nullptr;
+                position = (position + step) & mask;
+            }
+        }
+
+        // Starts loading the control group and first slot that a lookup of keyHash will probe.
+        void prefetch(Hash keyHash) const {
+            if (m_capacity == 0) return;
+
+#if defined(__GNUC__) || defined(__clang__)
+            Size position = (keyHash >> 7) & (m_capacity - 1);
+            __builtin_prefetch(m_control + position);
+            __builtin_prefetch(m_slots + position);
+#endif
+        }
+
+        // Returns the entry for key, constructing it from args first if the key is absent; second tells whether it was inserted.
+        template<typename... Args>
+        Pair<EntryType*, Boolean> emplace(const KeyType& key, Args&&... args) {
+            return emplaceHashed(key, hashOf(key), TypeTraits::forward<Args>(args)...);
+        }
+
+        // emplace() for a key whose hashOf() the caller already computed.
+        template<typename... Args>
+        Pair<EntryType*, Boolean> emplaceHashed(const KeyType& key, Hash keyHash, Args&&... args) {
+            if (EntryType* existing = find(key, keyHash)) {
+                return Pair<EntryType*, Boolean>(existing, false);
+            }
+
+            if (m_growthLeft == 0) {
+                // Mostly tombstones: rebuild at the same size instead of growing.
+                rehash(m_size < maxLoadFor(m_capacity) / 2 ? m_capacity : capacityFor(m_size + 1));
+            }
+            Size index = findFree(keyHash);
+            m_allocator.construct(m_slots + index, TypeTraits::forward<Args>(args)...);
+            if (m_control[index] == Empty) {
+                --m_growthLeft;
+            }
+            setControl(index, static_cast<Int8>(keyHash & 0x7F));
+            ++m_size;
+            return Pair<EntryType*, Boolean>(m_slots + index, true);
+        }
+
+        Boolean erase(const KeyType& key) {
+            EntryType* entry = find(key);
+            if (!entry) return false;
+
+            Size index = static_cast<Size>(entry - m_slots);
+            m_allocator.destroy(entry);
+            setControl(index, Deleted);
+            --m_size;
+            return true;
+        }
+
+        // Index of the first occupied slot at or after index, or capacity() if there is none.
+        [[nodiscard]] Size nextOccupied(Size index) const {
+            while (index < m_capacity && m_control[index] < 0) {
+                ++index;
+            }
+            return index;
+        }
+
+        EntryType& slotAt(Size index) const {
+            return m_slots[index];
+        }
+
+    private:
+        Int8* m_control;        // m_capacity control bytes followed by a copy of the first GroupWidth
+        EntryType* m_slots;
+        Size m_capacity;        // Zero or a power of two no smaller than MinCapacity
+        Size m_size;
+        Size m_growthLeft;      // Inserts into empty slots allowed before the next rehash
+        Memory::Allocator<EntryType> m_allocator;
+
+        void setControl(Size index, Int8 value) {
+            m_control[index] = value;
+            if (index < GroupWidth) {
+                m_control[m_capacity + index] = value;
+            }
+        }
+
+        void fillControl(Int8 value) {
+            for (Size i = 0; i < m_capacity + GroupWidth; ++i) {
+                m_control[i] = value;
+            }
+        }
+
+        Size findFree(Hash keyHash) const {
+            Size mask = m_capacity - 1;
+            Size position = (keyHash >> 7) & mask;
+            for (Size step = GroupWidth;; step += GroupWidth) {
+                UInt32 bits = Group(m_control + position).matchFree();
+                if (bits) {
+                    return (position + lowestBit(bits)) & mask;
+                }
+                position = (position + step) & mask;
+            }
+        }
+
+        void rehash(Size newCapacity) {
+            Int8* oldControl = m_control;
+            EntryType* oldSlots = m_slots;
+            Size oldCapacity = m_capacity;
+
+            m_control = new Int8[newCapacity + GroupWidth];
+            m_slots = m_allocator.allocate(newCapacity);
+            m_capacity = newCapacity;
+            fillControl(Empty);
+
+            for (Size i = 0; i < oldCapacity; ++i) {
+                if (oldControl[i] >= 0) {
+                    Hash keyHash = hashOf(KeyOf::get(oldSlots[i]));
+                    Size index = findFree(keyHash);
+                    m_allocator.construct(m_slots + index, TypeTraits::move(oldSlots[i]));
+                    m_allocator.destroy(oldSlots + i);
+                    setControl(index, static_cast<Int8>(keyHash & 0x7F));
+                }
+            }
+            m_growthLeft = maxLoadFor(m_capacity) - m_size;
+
+            delete[] oldControl;
+            m_allocator.deallocate(oldSlots);
+        }
+
+        void copyFrom(const HashTable& other) {
+            if (other.m_capacity == 0) return;
+
+            m_control = new Int8[other.m_capacity + GroupWidth];
+            m_slots = m_allocator.allocate(other.m_capacity);
+            m_capacity = other.m_capacity;
+
+            // Entries keep their slots, so the copy needs no rehashing. Slots read as deleted until their entry is built.
+            for (Size i = 0; i < m_capacity + GroupWidth; ++i) {
+                m_control[i] = other.m_control[i] >= 0 ? Deleted : other.m_control[i];
+            }
+            m_growthLeft = other.m_growthLeft;
+            for (Size i = 0; i < m_capacity; ++i) {
+                if (other.m_control[i] >= 0) {
+                    m_allocator.construct(m_slots + i, other.m_slots[i]);
+                    setControl(i, other.m_control[i]);
+                    ++m_size;
+                }
+            }
+        }
+
+        void destroy() {
+            if (m_capacity == 0) return;
+
+            clear();
+            delete[] m_control;
+            m_allocator.deallocate(m_slots);
+            m_control = nullptr;
+            m_slots = nullptr;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+    };
+}
@@ -22,3 +22,309 @@
  */
 
 #pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Exceptions/InvalidStateException.h>
+
+namespace Cedar::Core::Container {
+    // Embedded in an element to let it join one LinkedList. Copying an element does not copy its membership.
+    class LinkedListHook {
+    public:
+        LinkedListHook() : m_previous(nullptr), m_next(nullptr) {}
+
+        LinkedListHook(const LinkedListHook&) : LinkedListHook() {}
+
+        LinkedListHook& operator=(const LinkedListHook&) {
+            return *this;
+        }
+
+        [[nodiscard]] Boolean isLinked() const {
+            return m_next != nullptr;
+        }
+
+    private:
+        template<typename T, LinkedListHook T::*Hook>
+        friend class LinkedList;
+
+        LinkedListHook* m_previous;
+        LinkedListHook* m_next;
+    };
+
+    // Intrusive doubly-linked list threading elements through their Hook member, e.g. LinkedList<Entry, &Entry::hook>.
+    // The list never allocates or owns elements: insertion, removal, moving an element and splicing whole lists are
+    // all O(1). An element must outlive its membership and may be in at most one list per hook.
+    template<typename T, LinkedListHook T::*Hook>
+    class LinkedList {
+    private:
+        // Circular: the sentinel's next is the front and its previous the back; an empty list points at itself.
+        LinkedListHook m_sentinel;
+        Size m_size;
+
+        static LinkedListHook* hookOf(T& element) {
+            return &(element.*Hook);
+        }
+
+        // The element containing hook, found by subtracting the offset of Hook within T.
+        static T* elementOf(LinkedListHook* hook) {
+            union Probe {
+                T object;
+
+                Probe() {}
+
+                ~Probe() {}
+            };
+            Probe probe;
+            Size offset = reinterpret_cast<Byte*>(&(probe.object.*Hook)) - reinterpret_cast<Byte*>(&probe.object);
+            return reinterpret_cast<T*>(reinterpret_cast<Byte*>(hook) - offset);
+        }
+
+        static void link(LinkedListHook* hook, LinkedListHook* before) {
+            hook->m_next = before;
+            hook->m_previous = before->m_previous;
+            before->m_previous->m_next = hook;
+            before->m_previous = hook;
+        }
+
+        static void unlink(LinkedListHook* hook) {
+            hook->m_previous->m_next = hook->m_next;
+            hook->m_next->m_previous = hook->m_previous;
+            hook->m_previous = nullptr;
+            hook->m_next = nullptr;
+        }
+
+        void insertBefore(LinkedListHook* before, T& element) {
+            LinkedListHook* hook = hookOf(element);
+            if (hook->isLinked()) {
+                throw InvalidStateException("Element is already in a list");
+            }
+            link(hook, before);
+            ++m_size;
+        }
+
+        LinkedListHook* checkedFirst() const {
+            if (m_size == 0) {
+                throw InvalidStateException("LinkedList is empty");
+            }
+            return m_sentinel.m_next;
+        }
+
+        LinkedListHook* checkedLast() const {
+            if (m_size == 0) {
+                throw InvalidStateException("LinkedList is empty");
+            }
+            return m_sentinel.m_previous;
+        }
+
+        void reset() {
+            m_sentinel.m_previous = &m_sentinel;
+            m_sentinel.m_next = &m_sentinel;
+            m_size = 0;
+        }
+
+        // Takes over other's elements, leaving other empty. Only the end elements point at the sentinel.
+        void takeFrom(LinkedList& other) {
+            if (other.m_size == 0) {
+                reset();
+                return;
+            }
+            m_sentinel.m_next = other.m_sentinel.m_next;
+            m_sentinel.m_previous = other.m_sentinel.m_previous;
+            m_sentinel.m_next->m_previous = &m_sentinel;
+            m_sentinel.m_previous->m_next = &m_sentinel;
+            m_size = other.m_size;
+            other.reset();
+        }
+
+    public:
+        template<typename Value>
+        class BasicIterator {
+        public:
+            explicit BasicIterator(LinkedListHook* hook) : m_hook(hook) {}
+
+            BasicIterator& operator++() {
+                m_hook = m_hook->m_next;
+                return *this;
+            }
+
+            BasicIterator& operator--() {
+                m_hook = m_hook->m_previous;
+                return *this;
+            }
+
+            Value& operator*() const {
+                return *elementOf(m_hook);
+            }
+
+            Value* operator->() const {
+                return elementOf(m_hook);
+            }
+
+            Boolean operator==(const BasicIterator& other) const {
+                return m_hook == other.m_hook;
+            }
+
+            Boolean operator!=(const BasicIterator& other) const {
+                return m_hook != other.m_hook;
+            }
+
+        private:
+            LinkedListHook* m_hook;
+        };
+
+        using Iterator = BasicIterator<T>;
+        using ConstIterator = BasicIterator<const T>;
+
+        LinkedList() {
+            reset();
+        }
+
+        LinkedList(const LinkedList&) = delete;
+        LinkedList& operator=(const LinkedList&) = delete;
+
+        LinkedList(LinkedList&& other) noexcept {
+            takeFrom(other);
+        }
+
+        LinkedList& operator=(LinkedList&& other) noexcept {
+            if (this != &other) {
+                clear();
+                takeFrom(other);
+            }
+            return *this;
+        }
+
+        // Unlinks the remaining elements so that they can join another list.
+        ~LinkedList() {
+            clear();
+        }
+
+        void pushFront(T& element) {
+            insertBefore(m_sentinel.m_next, element);
+        }
+
+        void pushBack(T& element) {
+            insertBefore(&m_sentinel, element);
+        }
+
+        // Links element just before position, which must be in this list.
+        void insertBefore(T& position, T& element) {
+            insertBefore(hookOf(position), element);
+        }
+
+        void insertAfter(T& position, T& element) {
+            insertBefore(hookOf(position)->m_next, element);
+        }
+
+        // Unlinks element, which must be in this list.
+        void remove(T& element) {
+            unlink(hookOf(element));
+            --m_size;
+        }
+
+        T& popFront() {
+            LinkedListHook* hook = checkedFirst();
+            unlink(hook);
+            --m_size;
+            return *elementOf(hook);
+        }
+
+        T& popBack() {
+            LinkedListHook* hook = checkedLast();
+            unlink(hook);
+            --m_size;
+            return *elementOf(hook);
+        }
+
+        // Moves element, which must be in this list, to the front; the usual touch on an LRU hit.
+        void moveToFront(T& element) {
+            LinkedListHook* hook = hookOf(element);
+            if (m_sentinel.m_next == hook) return;
+
+            unlink(hook);
+            link(hook, m_sentinel.m_next);
+        }
+
+        void moveToBack(T& element) {
+            LinkedListHook* hook = hookOf(element);
+            if (m_sentinel.m_previous == hook) return;
+
+            unlink(hook);
+            link(hook, &m_sentinel);
+        }
+
+        // Moves every element of other, in order, to the end of this list.
+        void spliceBack(LinkedList& other) {
+            splice(&m_sentinel, other);
+        }
+
+        void spliceFront(LinkedList& other) {
+            splice(m_sentinel.m_next, other);
+        }
+
+        T& front() {
+            return *elementOf(checkedFirst());
+        }
+
+        const T& front() const {
+            return *elementOf(checkedFirst());
+        }
+
+        T& back() {
+            return *elementOf(checkedLast());
+        }
+
+        const T& back() const {
+            return *elementOf(checkedLast());
+        }
+
+        [[nodiscard]] Size size() const {
+            return m_size;
+        }
+
+        [[nodiscard]] Boolean isEmpty() const {
+            return m_size == 0;
+        }
+
+        // Unlinks every element in O(n); the elements themselves are left alone.
+        void clear() {
+            LinkedListHook* hook = m_sentinel.m_next;
+            while (hook != &m_sentinel) {
+                LinkedListHook* next = hook->m_next;
+                hook->m_previous = nullptr;
+                hook->m_next = nullptr;
+                hook = next;
+            }
+            reset();
+        }
+
+        Iterator begin() {
+            return Iterator(m_sentinel.m_next);
+        }
+
+        Iterator end() {
+            return Iterator(&m_sentinel);
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(m_sentinel.m_next);
+        }
+
+        ConstIterator end() const {
+            return ConstIterator(const_cast<LinkedListHook*>(&m_sentinel));
+        }
+
+    private:
+        void splice(LinkedListHook* before, LinkedList& other) {
+            if (other.m_size == 0 || &other == this) return;
+
+            LinkedListHook* first = other.m_sentinel.m_next;
+            LinkedListHook* last = other.m_sentinel.m_previous;
+            first->m_previous = before->m_previous;
+            before->m_previous->m_next = first;
+            last->m_next = before;
+            before->m_previous = last;
+            m_size += other.m_size;
+            other.reset();
+        }
+    };
+}
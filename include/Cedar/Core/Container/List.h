@@ -24,162 +24,254 @@
 #pragma once
 
 #include <Cedar/Core/BasicTypes.h>
-#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Memory.h>
 
 #include <Cedar/Core/Exceptions/OutOfRangeException.h>
 
 namespace Cedar::Core::Container {
-    template<typename T>
-    class ListNode {
-    public:
-        T value;
-        ListNode<T>* next;
-
-        explicit ListNode(T val) : value(val), next(nullptr) {}
-    };
-
+    // Segmented array. Segment k holds FirstSegmentSize << k elements, so appending never moves existing elements,
+    // an index maps to its segment with one bit scan, and n elements take O(log n) allocations.
     template<typename T>
     class List {
     private:
-        ListNode<T>* m_head;
-        ListNode<T>* m_tail;
+        static constexpr Size FirstSegmentShift = 3;
+        static constexpr Size FirstSegmentSize = Size(1) << FirstSegmentShift;
+
+        T **m_segments;
+        Size m_segmentCount;        // Segments allocated, some of which may be empty after remove()
+        Size m_segmentCapacity;     // Length of the m_segments table
         Size m_size;
-        Threading::Mutex m_mtx;
+        Memory::Allocator<T> m_allocator;
+
+        static Size highestBit(Size value) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<Size>(63 - __builtin_clzll(value));
+#else
+            Size index = 0;
+            while (value >>= 1) {
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        static Size segmentSize(Size segment) {
+            return FirstSegmentSize << segment;
+        }
+
+        static Size segmentOf(Size index, Size &offset) {
+            Size segment = highestBit((index >> FirstSegmentShift) + 1);
+            offset = index + FirstSegmentSize - segmentSize(segment);
+            return segment;
+        }
+
+        T *slot(Size index) const {
+            Size offset;
+            Size segment = segmentOf(index, offset);
+            return m_segments[segment] + offset;
+        }
+
+        // Returns uninitialised storage for the element at index m_size, allocating its segment if needed.
+        T *nextSlot() {
+            Size offset;
+            Size segment = segmentOf(m_size, offset);
+            if (segment == m_segmentCount) {
+                if (m_segmentCount == m_segmentCapacity) {
+                    Size capacity = m_segmentCapacity == 0 ? 4 : m_segmentCapacity * 2;
+                    T **segments = new T *[capacity];
+                    for (Size i = 0; i < m_segmentCount; ++i) {
+                        segments[i] = m_segments[i];
+                    }
+                    delete[] m_segments;
+                    m_segments = segments;
+                    m_segmentCapacity = capacity;
+                }
+                m_segments[m_segmentCount++] = m_allocator.allocate(segmentSize(segment));
+            }
+            return m_segments[segment] + offset;
+        }
+
+        // Kept out of line so that the bounds check is all operator[] inlines.
+        [[noreturn]] static void throwOutOfRange() {
+            throw OutOfRangeException("Index out of range");
+        }
 
     public:
-        List() : m_head(nullptr), m_tail(nullptr), m_size(0) {}
+        List() : m_segments(nullptr), m_segmentCount(0), m_segmentCapacity(0), m_size(0) {}
+
+        List(const List &other) : List() {
+            for (const T &value : other) {
+                append(value);
+            }
+        }
+
+        List(List &&other) noexcept
+                : m_segments(other.m_segments), m_segmentCount(other.m_segmentCount),
+                  m_segmentCapacity(other.m_segmentCapacity), m_size(other.m_size) {
+            other.m_segments = nullptr;
+            other.m_segmentCount = 0;
+            other.m_segmentCapacity = 0;
+            other.m_size = 0;
+        }
+
+        List &operator=(const List &other) {
+            if (this != &other) {
+                List copy(other);
+                *this = TypeTraits::move(copy);
+            }
+            return *this;
+        }
+
+        List &operator=(List &&other) noexcept {
+            if (this != &other) {
+                clear();
+                m_segments = other.m_segments;
+                m_segmentCount = other.m_segmentCount;
+                m_segmentCapacity = other.m_segmentCapacity;
+                m_size = other.m_size;
+                other.m_segments = nullptr;
+                other.m_segmentCount = 0;
+                other.m_segmentCapacity = 0;
+                other.m_size = 0;
+            }
+            return *this;
+        }
 
         ~List() {
             clear();
         }
 
-        void append(T value) {
-            m_mtx.lock();
-            auto* newNode = new ListNode<T>(value);
-            if (!m_head) {
-                m_head = newNode;
-                m_tail = newNode;
-            } else {
-                m_tail->next = newNode;
-                m_tail = newNode;
-            }
-            m_size++;
-            m_mtx.unlock();
+        void append(const T &value) {
+            emplace(value);
         }
 
-        Boolean remove(T value) {
-            m_mtx.lock();
-            ListNode<T>* current = m_head;
-            ListNode<T>* prev = nullptr;
+        void append(T &&value) {
+            emplace(TypeTraits::move(value));
+        }
 
-            while (current != nullptr) {
-                if (current->value == value) {
-                    if (prev) {
-                        prev->next = current->next;
-                    } else {
-                        m_head = current->next;
-                    }
+        // Constructs an element in place at the end and returns it. References to elements stay valid across appends.
+        template<typename... Args>
+        T &emplace(Args &&... args) {
+            T *target = nextSlot();
+            m_allocator.construct(target, TypeTraits::forward<Args>(args)...);
+            ++m_size;
+            return *target;
+        }
 
-                    if (current == m_tail) {
-                        m_tail = prev;
+        // Removes the first element equal to value, moving the later elements down by one.
+        Boolean remove(const T &value) {
+            for (Size i = 0; i < m_size; ++i) {
+                if (*slot(i) == value) {
+                    for (Size j = i; j + 1 < m_size; ++j) {
+                        *slot(j) = TypeTraits::move(*slot(j + 1));
                     }
-
-                    delete current;
-                    m_size--;
-                    m_mtx.unlock();
+                    m_allocator.destroy(slot(--m_size));
                     return true;
                 }
-                prev = current;
-                current = current->next;
             }
-            m_mtx.unlock();
             return false;
         }
 
         void clear() {
-            m_mtx.lock();
-            ListNode<T>* current = m_head;
-            while (current != nullptr) {
-                ListNode<T>* next = current->next;
-                delete current;
-                current = next;
-            }
-            m_head = nullptr;
-            m_tail = nullptr;
+            for (Size i = 0; i < m_size; ++i) {
+                m_allocator.destroy(slot(i));
+            }
+            for (Size i = 0; i < m_segmentCount; ++i) {
+                m_allocator.deallocate(m_segments[i]);
+            }
+            delete[] m_segments;
+            m_segments = nullptr;
+            m_segmentCount = 0;
+            m_segmentCapacity = 0;
             m_size = 0;
-            m_mtx.unlock();
         }
 
         [[nodiscard]] Size size() const {
-            m_mtx.lock();
-            Size currentSize = m_size;
-            m_mtx.unlock();
-            return currentSize;
+            return m_size;
         }
 
-        ListNode<T>* getNodeAt(Size index) const {
-            ListNode<T>* current = m_head;
-            Size currentIndex = 0;
-            while (current != nullptr && currentIndex < index) {
-                current = current->next;
-                currentIndex++;
-            }
-            return current;
+        [[nodiscard]] Boolean isEmpty() const {
+            return m_size == 0;
         }
 
-        T& operator[](Size index) {
-            m_mtx.lock();
-            ListNode<T>* node = getNodeAt(index);
-            if (node == nullptr) {
-                m_mtx.unlock();
-                throw OutOfRangeException("Index out of range");
+        T &operator[](Size index) {
+            if (index >= m_size) {
+                throwOutOfRange();
             }
-            T& value = node->value;
-            m_mtx.unlock();
-            return value;
+            return *slot(index);
         }
 
-        const T& operator[](Size index) const {
-            m_mtx.lock();
-            ListNode<T>* node = getNodeAt(index);
-            if (node == nullptr) {
-                m_mtx.unlock();
-                throw OutOfRangeException("Index out of range");
+        const T &operator[](Size index) const {
+            if (index >= m_size) {
+                throwOutOfRange();
             }
-            const T& value = node->value;
-            m_mtx.unlock();
-            return value;
+            return *slot(index);
         }
 
-        class Iterator {
+        // Walks one segment at a time, so iteration is a pointer increment within each segment.
+        template<typename Value>
+        class BasicIterator {
         public:
-            explicit Iterator(ListNode<T>* node) : m_current(node) {}
+            BasicIterator(T *const *segments, Size remaining)
+                    : m_segments(segments), m_segment(0), m_current(remaining ? segments[0] : nullptr),
+                      m_segmentEnd(remaining ? m_current + FirstSegmentSize : nullptr), m_remaining(remaining) {}
 
-            T& operator*() const {
-                return m_current->value;
+            Value &operator*() const {
+                return *m_current;
             }
 
-            Iterator& operator++() {
-                if (m_current) m_current = m_current->next;
+            Value *operator->() const {
+                return m_current;
+            }
+
+            BasicIterator &operator++() {
+                if (--m_remaining != 0 && ++m_current == m_segmentEnd) {
+                    m_current = m_segments[++m_segment];
+                    m_segmentEnd = m_current + segmentSize(m_segment);
+                }
                 return *this;
             }
 
-            Boolean operator!=(const Iterator& other) const {
-                return m_current != other.m_current;
+            BasicIterator operator++(Int32) {
+                BasicIterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            // Only iterators over the same list may be compared.
+            Boolean operator==(const BasicIterator &other) const {
+                return m_remaining == other.m_remaining;
+            }
+
+            Boolean operator!=(const BasicIterator &other) const {
+                return m_remaining != other.m_remaining;
             }
 
         private:
-            ListNode<T>* m_current;
+            T *const *m_segments;
+            Size m_segment;
+            T *m_current;
+            T *m_segmentEnd;
+            Size m_remaining;
         };
 
-        Iterator begin() const {
-            return Iterator(m_head);
+        using Iterator = BasicIterator<T>;
+        using ConstIterator = BasicIterator<const T>;
+
+        Iterator begin() {
+            return Iterator(m_segments, m_size);
         }
 
-        Iterator end() const {
-            return Iterator(nullptr);
+        Iterator end() {
+            return Iterator(m_segments, 0);
         }
-    };
 
-}
+        ConstIterator begin() const {
+            return ConstIterator(m_segments, m_size);
+        }
 
+        ConstIterator end() const {
+            return ConstIterator(m_segments, 0);
+        }
+    };
+}
@@ -0,0 +1,341 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Memory.h>
+#include <Cedar/Core/String.h>
+#include <Cedar/Core/Container/HashTable.h>
+#include <Cedar/Core/Container/LinkedList.h>
+#include <Cedar/Core/Container/List.h>
+#include <Cedar/Core/Container/Stack.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+
+namespace Cedar::Core::Container {
+    enum class CachePolicy : Byte {
+        // Exact least-recently-used order; every hit moves its entry to the front of the shard's list.
+        Lru,
+        // Second chance: a hit only sets the entry's reference bit, and eviction sweeps past referenced entries once.
+        Clock
+    };
+
+    // How much of an LruCache's capacity a value uses. Every entry is charged at least 1.
+    template<typename ValueType>
+    struct CacheWeight {
+        Size operator()(const ValueType&) const {
+            return 1;
+        }
+    };
+
+    template<>
+    struct CacheWeight<String> {
+        Size operator()(const String& value) const {
+            return value.rawLength();
+        }
+    };
+
+    struct CacheStatistics {
+        UInt64 hits = 0;
+        UInt64 misses = 0;
+        UInt64 evictions = 0;
+    };
+
+    // Thread-safe cache that evicts entries once their total weight exceeds its capacity.
+    //
+    // Keys are spread over shards by the top bits of their hash, each with its own lock, table, recency list and an
+    // even share of the capacity, so eviction order is exact only within a shard. A single entry can weigh at most
+    // its shard's share, maxEntryWeight(); heavier values are not cached. Entries live in a per-shard segmented List
+    // and are recycled through a free stack, so a warm cache does not allocate on put().
+    template<typename KeyType, typename ValueType, typename Weigher = CacheWeight<ValueType>>
+    class LruCache {
+    public:
+        static constexpr Size DefaultShardCount = 16;
+
+        // Shards are only split off while each keeps at least this much capacity, so small caches use fewer shards.
+        static constexpr Size MinShardCapacity = 64;
+
+        // shardCount is rounded up to a power of two, then halved until every shard gets MinShardCapacity. The shard
+        // capacities add up to exactly capacity.
+        explicit LruCache(Size capacity, CachePolicy policy = CachePolicy::Lru, Size shardCount = DefaultShardCount)
+                : m_policy(policy), m_shardShift(64), m_capacity(capacity) {
+            if (capacity == 0) {
+                throw InvalidArgumentException("Cache capacity must be positive");
+            }
+            m_shardCount = 1;
+            while (m_shardCount < shardCount && capacity / (m_shardCount * 2) >= MinShardCapacity) {
+                m_shardCount *= 2;
+                --m_shardShift;
+            }
+            m_shards = new Shard[m_shardCount];
+            for (Size i = 0; i < m_shardCount; ++i) {
+                m_shards[i].capacity = capacity / m_shardCount + (i < capacity % m_shardCount);
+            }
+        }
+
+        LruCache(const LruCache&) = delete;
+        LruCache& operator=(const LruCache&) = delete;
+
+        ~LruCache() {
+            delete[] m_shards;
+        }
+
+        // Copies the value cached for key into out and counts a hit, or counts a miss and returns false.
+        Boolean get(const KeyType& key, ValueType& out) {
+            Hash keyHash = KeyHash<KeyType>()(key);
+            Shard& shard = shardFor(keyHash);
+            Threading::LockGuard<Threading::Mutex> lock(shard.lock);
+            Entry** found = shard.index.find(key, keyHash);
+            if (!found) {
+                ++shard.misses;
+                return false;
+            }
+            ++shard.hits;
+            touch(shard, **found);
+            out = (*found)->value;
+            return true;
+        }
+
+        // Inserts or replaces the value for key, then evicts other entries until the shard is back within capacity.
+        // A value heavier than its shard's capacity is not cached, and any older value for its key is dropped.
+        void put(const KeyType& key, const ValueType& value) {
+            Hash keyHash = KeyHash<KeyType>()(key);
+            Size weight = weightOf(value);
+            Shard& shard = shardFor(keyHash);
+            Threading::LockGuard<Threading::Mutex> lock(shard.lock);
+            Entry** found = shard.index.find(key, keyHash);
+            if (weight > shard.capacity) {
+                if (found) {
+                    shard.erase(*found);
+                }
+                return;
+            }
+
+            if (found) {
+                Entry* entry = *found;
+                entry->value = value;
+                shard.weight += weight - entry->weight;
+                entry->weight = weight;
+                touch(shard, *entry);
+            } else {
+                Entry* entry = shard.allocate(key, value, weight);
+                shard.index.emplaceHashed(key, keyHash, entry);
+                if (m_policy == CachePolicy::Lru) {
+                    shard.order.pushFront(*entry);
+                } else {
+                    shard.order.pushBack(*entry);
+                }
+                shard.weight += weight;
+            }
+            evict(shard);
+        }
+
+        Boolean remove(const KeyType& key) {
+            Hash keyHash = KeyHash<KeyType>()(key);
+            Shard& shard = shardFor(keyHash);
+            Threading::LockGuard<Threading::Mutex> lock(shard.lock);
+            Entry** found = shard.index.find(key, keyHash);
+            if (!found) return false;
+
+            shard.erase(*found);
+            return true;
+        }
+
+        // Drops every entry; the statistics are kept.
+        void clear() {
+            for (Size i = 0; i < m_shardCount; ++i) {
+                Threading::LockGuard<Threading::Mutex> lock(m_shards[i].lock);
+                m_shards[i].clear();
+            }
+        }
+
+        [[nodiscard]] Size size() const {
+            Size total = 0;
+            for (Size i = 0; i < m_shardCount; ++i) {
+                Threading::LockGuard<Threading::Mutex> lock(m_shards[i].lock);
+                total += m_shards[i].index.size();
+            }
+            return total;
+        }
+
+        // Total weight of the cached entries.
+        [[nodiscard]] Size weight() const {
+            Size total = 0;
+            for (Size i = 0; i < m_shardCount; ++i) {
+                Threading::LockGuard<Threading::Mutex> lock(m_shards[i].lock);
+                total += m_shards[i].weight;
+            }
+            return total;
+        }
+
+        [[nodiscard]] Size capacity() const {
+            return m_capacity;
+        }
+
+        // The heaviest value that put() will cache: the capacity of the smallest shard.
+        [[nodiscard]] Size maxEntryWeight() const {
+            return m_shards[m_shardCount - 1].capacity;
+        }
+
+        [[nodiscard]] Size shardCount() const {
+            return m_shardCount;
+        }
+
+        [[nodiscard]] CachePolicy policy() const {
+            return m_policy;
+        }
+
+        [[nodiscard]] CacheStatistics statistics() const {
+            CacheStatistics total;
+            for (Size i = 0; i < m_shardCount; ++i) {
+                Threading::LockGuard<Threading::Mutex> lock(m_shards[i].lock);
+                total.hits += m_shards[i].hits;
+                total.misses += m_shards[i].misses;
+                total.evictions += m_shards[i].evictions;
+            }
+            return total;
+        }
+
+    private:
+        struct Entry {
+            KeyType key;
+            ValueType value;
+            Size weight;
+            Boolean referenced;
+            LinkedListHook hook;
+
+            Entry(const KeyType& key, const ValueType& value, Size weight)
+                    : key(key), value(value), weight(weight), referenced(false) {}
+        };
+
+        // The index stores entry pointers and reads keys through them, so each key is kept once.
+        struct KeyOfEntry {
+            static const KeyType& get(Entry* const& entry) {
+                return entry->key;
+            }
+        };
+
+        // Storage for one Entry; List never moves its elements, so entries keep their addresses.
+        struct EntrySlot {
+            alignas(Entry) Byte storage[sizeof(Entry)];
+
+            EntrySlot() {}
+        };
+
+        struct alignas(64) Shard {
+            Threading::Mutex lock;
+            HashTable<KeyType, Entry*, KeyOfEntry> index;
+            LinkedList<Entry, &Entry::hook> order;      // LRU: most recent first. Clock: the hand is at the front.
+            List<EntrySlot> slots;
+            Stack<Entry*> freeEntries;
+            Size weight = 0;
+            Size capacity = 0;
+            UInt64 hits = 0;
+            UInt64 misses = 0;
+            UInt64 evictions = 0;
+            Memory::Allocator<Entry> allocator;
+
+            ~Shard() {
+                clear();
+            }
+
+            Entry* allocate(const KeyType& key, const ValueType& value, Size weight) {
+                Entry* entry;
+                if (!freeEntries.tryPop(entry)) {
+                    entry = reinterpret_cast<Entry*>(slots.emplace().storage);
+                }
+                try {
+                    allocator.construct(entry, key, value, weight);
+                } catch (...) {
+                    freeEntries.push(entry);
+                    throw;
+                }
+                return entry;
+            }
+
+            void release(Entry* entry) {
+                allocator.destroy(entry);
+                freeEntries.push(entry);
+            }
+
+            void erase(Entry* entry) {
+                index.erase(entry->key);
+                order.remove(*entry);
+                weight -= entry->weight;
+                release(entry);
+            }
+
+            void clear() {
+                index.clear();
+                while (!order.isEmpty()) {
+                    release(&order.popFront());
+                }
+                weight = 0;
+            }
+        };
+
+        CachePolicy m_policy;
+        Size m_shardShift;
+        Size m_capacity;
+        Size m_shardCount;
+        Shard* m_shards;
+
+        // The table probes with the low bits of the same hash, so shards are picked by the high ones.
+        Shard& shardFor(Hash keyHash) const {
+            return m_shards[m_shardCount == 1 ? 0 : keyHash >> m_shardShift];
+        }
+
+        Size weightOf(const ValueType& value) const {
+            Size weight = Weigher()(value);
+            return weight == 0 ? 1 : weight;
+        }
+
+        void touch(Shard& shard, Entry& entry) {
+            if (m_policy == CachePolicy::Lru) {
+                shard.order.moveToFront(entry);
+            } else {
+                entry.referenced = true;
+            }
+        }
+
+        void evict(Shard& shard) {
+            while (shard.weight > shard.capacity) {
+                Entry* victim;
+                if (m_policy == CachePolicy::Lru) {
+                    victim = &shard.order.back();
+                } else {
+                    victim = &shard.order.front();
+                    if (victim->referenced) {
+                        victim->referenced = false;
+                        shard.order.moveToBack(*victim);
+                        continue;
+                    }
+                }
+                shard.erase(victim);
+                ++shard.evictions;
+            }
+        }
+    };
+}
@@ -54,5 +54,13 @@ namespace Cedar::Core::Container {
             }
             return *this;
         }
+
+        Boolean operator==(const Pair& other) const {
+            return first == other.first && second == other.second;
+        }
+
+        Boolean operator!=(const Pair& other) const {
+            return !(*this == other);
+        }
     };
 }
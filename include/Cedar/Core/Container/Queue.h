@@ -21,4 +21,364 @@
  * SOFTWARE.
  */
 
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Memory.h>
+#include <Cedar/Core/Threading/Thread.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
+
+#include <atomic>
+
+namespace Cedar::Core::Container {
+    // Pieces shared by the bounded queues below.
+    class QueueBase {
+    protected:
+        static constexpr Size CacheLineSize = 64;
+
+        // Blocking operations spin this many times before they start yielding the processor.
+        static constexpr UInt32 SpinLimit = 64;
+
+        static Size roundUpCapacity(Size capacity) {
+            if (capacity == 0) {
+                throw InvalidArgumentException("Queue capacity must be positive.");
+            }
+            Size rounded = 2;
+            while (rounded < capacity) {
+                rounded <<= 1;
+            }
+            return rounded;
+        }
+
+        // Retries attempt until it succeeds, spinning at first and then yielding.
+        template<typename Attempt>
+        static void retry(Attempt attempt) {
+            for (UInt32 attempts = 0; !attempt(); ++attempts) {
+                if (attempts < SpinLimit) {
+#if defined(__x86_64__) || defined(__i386__)
+                    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+                    asm volatile("yield");
+#endif
+                } else {
+                    Threading::Thread::yield();
+                }
+            }
+        }
+    };
+
+    // Power-of-two ring in which every slot carries a sequence number (Vyukov's bounded queue). A producer holding
+    // ticket t may fill slot t & mask once its sequence is t, and publishes the item by setting it to t + 1; the
+    // consumer of that ticket empties it and sets it to t + capacity, handing it to the producer one lap later.
+    template<typename T>
+    class QueueRing : protected QueueBase {
+        // Items are moved into and out of slots after their ticket is claimed, where an exception would strand the slot.
+        static_assert(TypeTraits::IsNothrowMoveConstructible<T>::value && TypeTraits::IsNothrowMoveAssignable<T>::value,
+                      "Queue items must be nothrow move constructible and move assignable");
+
+    protected:
+        struct Slot {
+            std::atomic<Size> sequence;
+            alignas(T) Byte storage[sizeof(T)];
+
+            T* item() {
+                return reinterpret_cast<T*>(storage);
+            }
+        };
+
+        explicit QueueRing(Size capacity) : m_mask(roundUpCapacity(capacity) - 1), m_slots(new Slot[m_mask + 1]) {
+            for (Size i = 0; i <= m_mask; ++i) {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~QueueRing() {
+            Size tail = m_enqueue.load(std::memory_order_relaxed);
+            for (Size position = m_dequeue.load(std::memory_order_relaxed); position != tail; ++position) {
+                Slot& slot = m_slots[position & m_mask];
+                if (slot.sequence.load(std::memory_order_relaxed) == position + 1) {
+                    slot.item()->~T();
+                }
+            }
+            delete[] m_slots;
+        }
+
+        QueueRing(const QueueRing&) = delete;
+        QueueRing& operator=(const QueueRing&) = delete;
+
+        // Claims the next ticket with a compare-exchange, so any number of threads may push. Once a ticket is claimed
+        // its slot must be published or every later consumer stalls on it, so a constructor that may throw runs
+        // before the claim and the finished item is moved in afterwards.
+        template<typename... Args>
+        Boolean tryEmplaceShared(Args&&... args) {
+            if constexpr (noexcept(T(TypeTraits::forward<Args>(args)...))) {
+                return tryPublish(TypeTraits::forward<Args>(args)...);
+            } else {
+                T item(TypeTraits::forward<Args>(args)...);
+                return tryPublish(TypeTraits::move(item));
+            }
+        }
+
+        // Claims the next ticket with a compare-exchange, so any number of threads may pop.
+        Boolean tryPopShared(T& out) {
+            Size position = m_dequeue.load(std::memory_order_relaxed);
+            while (true) {
+                Slot& slot = m_slots[position & m_mask];
+                auto lag = static_cast<SSize>(slot.sequence.load(std::memory_order_acquire) - (position + 1));
+                if (lag == 0) {
+                    if (m_dequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        take(slot, position, out);
+                        return true;
+                    }
+                } else if (lag < 0) {
+                    return false;   // Nothing has been published for this ticket yet: the queue is empty
+                } else {
+                    position = m_dequeue.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // With one consumer nobody else moves the dequeue position, so it is advanced with a plain store.
+        Boolean tryPopSingle(T& out) {
+            Size position = m_dequeue.load(std::memory_order_relaxed);
+            Slot& slot = m_slots[position & m_mask];
+            if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+                return false;
+            }
+            m_dequeue.store(position + 1, std::memory_order_relaxed);
+            take(slot, position, out);
+            return true;
+        }
+
+        [[nodiscard]] Size ringCapacity() const {
+            return m_mask + 1;
+        }
+
+        [[nodiscard]] Size approximateSize() const {
+            Size head = m_dequeue.load(std::memory_order_relaxed);
+            Size tail = m_enqueue.load(std::memory_order_relaxed);
+            return tail > head ? tail - head : 0;
+        }
+
+    private:
+        const Size m_mask;
+        Slot* const m_slots;
+
+        // Producers and consumers each get a cache line of their own.
+        alignas(CacheLineSize) std::atomic<Size> m_enqueue{0};
+        alignas(CacheLineSize) std::atomic<Size> m_dequeue{0};
+
+        // Constructs the item in the claimed slot; the constructor used here must not throw.
+        template<typename... Args>
+        Boolean tryPublish(Args&&... args) {
+            Size position = m_enqueue.load(std::memory_order_relaxed);
+            while (true) {
+                Slot& slot = m_slots[position & m_mask];
+                auto lag = static_cast<SSize>(slot.sequence.load(std::memory_order_acquire) - position);
+                if (lag == 0) {
+                    if (m_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        new (slot.item()) T(TypeTraits::forward<Args>(args)...);
+                        slot.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (lag < 0) {
+                    return false;   // The slot still holds the item from one lap ago: the queue is full
+                } else {
+                    position = m_enqueue.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void take(Slot& slot, Size position, T& out) {
+            T* item = slot.item();
+            out = TypeTraits::move(*item);
+            item->~T();
+            slot.sequence.store(position + m_mask + 1, std::memory_order_release);
+        }
+    };
+
+    // Bounded lock-free queue for any number of producers and consumers. The capacity is rounded up to a power of two.
+    template<typename T>
+    class Queue : private QueueRing<T> {
+    public:
+        explicit Queue(Size capacity) : QueueRing<T>(capacity) {}
+
+        Boolean tryPush(const T& value) {
+            return this->tryEmplaceShared(value);
+        }
+
+        Boolean tryPush(T&& value) {
+            return this->tryEmplaceShared(TypeTraits::move(value));
+        }
+
+        template<typename... Args>
+        Boolean tryEmplace(Args&&... args) {
+            return this->tryEmplaceShared(TypeTraits::forward<Args>(args)...);
+        }
+
+        Boolean tryPop(T& out) {
+            return this->tryPopShared(out);
+        }
+
+        // Waits while the queue is full.
+        void push(const T& value) {
+            QueueBase::retry([&]() { return tryPush(value); });
+        }
+
+        void push(T&& value) {
+            QueueBase::retry([&]() { return this->tryEmplaceShared(TypeTraits::move(value)); });
+        }
+
+        // Waits while the queue is empty.
+        void pop(T& out) {
+            QueueBase::retry([&]() { return tryPop(out); });
+        }
+
+        [[nodiscard]] Size capacity() const {
+            return this->ringCapacity();
+        }
+
+        // Number of queued items; only a snapshot while other threads are pushing or popping.
+        [[nodiscard]] Size approximateSize() const {
+            return QueueRing<T>::approximateSize();
+        }
+    };
+
+    // Bounded lock-free queue for any number of producers and exactly one consumer thread.
+    template<typename T>
+    class MpscQueue : private QueueRing<T> {
+    public:
+        explicit MpscQueue(Size capacity) : QueueRing<T>(capacity) {}
+
+        Boolean tryPush(const T& value) {
+            return this->tryEmplaceShared(value);
+        }
+
+        Boolean tryPush(T&& value) {
+            return this->tryEmplaceShared(TypeTraits::move(value));
+        }
+
+        template<typename... Args>
+        Boolean tryEmplace(Args&&... args) {
+            return this->tryEmplaceShared(TypeTraits::forward<Args>(args)...);
+        }
+
+        // Must only be called from the consumer thread.
+        Boolean tryPop(T& out) {
+            return this->tryPopSingle(out);
+        }
+
+        void push(const T& value) {
+            QueueBase::retry([&]() { return tryPush(value); });
+        }
+
+        void push(T&& value) {
+            QueueBase::retry([&]() { return this->tryEmplaceShared(TypeTraits::move(value)); });
+        }
+
+        void pop(T& out) {
+            QueueBase::retry([&]() { return tryPop(out); });
+        }
+
+        [[nodiscard]] Size capacity() const {
+            return this->ringCapacity();
+        }
+
+        [[nodiscard]] Size approximateSize() const {
+            return QueueRing<T>::approximateSize();
+        }
+    };
+
+    // Bounded wait-free queue for exactly one producer thread and one consumer thread. Each side keeps a cached copy
+    // of the other side's position and only reloads it when the queue looks full or empty.
+    template<typename T>
+    class SpscQueue : private QueueBase {
+    public:
+        explicit SpscQueue(Size capacity) : m_mask(roundUpCapacity(capacity) - 1) {
+            m_items = m_allocator.allocate(m_mask + 1);
+        }
+
+        ~SpscQueue() {
+            Size tail = m_tail.load(std::memory_order_relaxed);
+            for (Size position = m_head.load(std::memory_order_relaxed); position != tail; ++position) {
+                m_allocator.destroy(m_items + (position & m_mask));
+            }
+            m_allocator.deallocate(m_items);
+        }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        // Must only be called from the producer thread. The item is constructed before the tail moves, so a throwing
+        // constructor leaves the queue as it was.
+        template<typename... Args>
+        Boolean tryEmplace(Args&&... args) {
+            Size tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_cachedHead > m_mask) {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (tail - m_cachedHead > m_mask) {
+                    return false;
+                }
+            }
+            m_allocator.construct(m_items + (tail & m_mask), TypeTraits::forward<Args>(args)...);
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        Boolean tryPush(const T& value) {
+            return tryEmplace(value);
+        }
+
+        Boolean tryPush(T&& value) {
+            return tryEmplace(TypeTraits::move(value));
+        }
+
+        // Must only be called from the consumer thread.
+        Boolean tryPop(T& out) {
+            Size head = m_head.load(std::memory_order_relaxed);
+            if (head == m_cachedTail) {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cachedTail) {
+                    return false;
+                }
+            }
+            T* item = m_items + (head & m_mask);
+            out = TypeTraits::move(*item);
+            m_allocator.destroy(item);
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        void push(const T& value) {
+            retry([&]() { return tryPush(value); });
+        }
+
+        void push(T&& value) {
+            retry([&]() { return tryEmplace(TypeTraits::move(value)); });
+        }
+
+        void pop(T& out) {
+            retry([&]() { return tryPop(out); });
+        }
+
+        [[nodiscard]] Size capacity() const {
+            return m_mask + 1;
+        }
+
+        [[nodiscard]] Size approximateSize() const {
+            Size head = m_head.load(std::memory_order_relaxed);
+            Size tail = m_tail.load(std::memory_order_relaxed);
+            return tail > head ? tail - head : 0;
+        }
+
+    private:
+        const Size m_mask;
+        T* m_items;
+        Memory::Allocator<T> m_allocator;
+
+        alignas(CacheLineSize) std::atomic<Size> m_tail{0};     // Written by the producer
+        Size m_cachedHead = 0;                                  // Producer's view of m_head
+        alignas(CacheLineSize) std::atomic<Size> m_head{0};     // Written by the consumer
+        Size m_cachedTail = 0;                                  // Consumer's view of m_tail
+    };
+}
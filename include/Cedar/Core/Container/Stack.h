@@ -21,4 +21,82 @@
  * SOFTWARE.
  */
 
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Container/ArrayList.h>
+#include <Cedar/Core/Exceptions/InvalidStateException.h>
+
+namespace Cedar::Core::Container {
+    // LIFO stack on a contiguous ArrayList. Not thread-safe; see ConcurrentStack for that.
+    template<typename T>
+    class Stack {
+    public:
+        Stack() = default;
+
+        explicit Stack(Size initialCapacity) : m_items(initialCapacity) {}
+
+        void push(const T& value) {
+            m_items.append(value);
+        }
+
+        void push(T&& value) {
+            m_items.append(TypeTraits::move(value));
+        }
+
+        template<typename... Args>
+        T& emplace(Args&&... args) {
+            return m_items.emplace(TypeTraits::forward<Args>(args)...);
+        }
+
+        // Removes and returns the top element.
+        T pop() {
+            T& top = this->top();
+            T value(TypeTraits::move(top));
+            m_items.truncate(m_items.size() - 1);
+            return value;
+        }
+
+        Boolean tryPop(T& out) {
+            if (m_items.isEmpty()) {
+                return false;
+            }
+            out = TypeTraits::move(m_items[m_items.size() - 1]);
+            m_items.truncate(m_items.size() - 1);
+            return true;
+        }
+
+        T& top() {
+            if (m_items.isEmpty()) {
+                throw InvalidStateException("Stack is empty");
+            }
+            return m_items.data()[m_items.size() - 1];
+        }
+
+        const T& top() const {
+            if (m_items.isEmpty()) {
+                throw InvalidStateException("Stack is empty");
+            }
+            return m_items.data()[m_items.size() - 1];
+        }
+
+        [[nodiscard]] Size size() const {
+            return m_items.size();
+        }
+
+        [[nodiscard]] Boolean isEmpty() const {
+            return m_items.isEmpty();
+        }
+
+        void reserve(Size capacity) {
+            m_items.reserve(capacity);
+        }
+
+        void clear() {
+            m_items.clear();
+        }
+
+    private:
+        ArrayList<T> m_items;
+    };
+}
@@ -30,7 +30,11 @@ namespace Cedar::Core::Container {
     class Tuple;
 
     template<>
-    class Tuple<> {};
+    class Tuple<> {
+    public:
+        Boolean operator==(const Tuple&) const { return true; }
+        Boolean operator!=(const Tuple&) const { return false; }
+    };
 
     template<typename T, typename... Ts>
     class Tuple<T, Ts...> : public Tuple<Ts...> {
@@ -38,7 +42,7 @@ namespace Cedar::Core::Container {
     public:
         Tuple(T val, Ts... vals) : Tuple<Ts...>(vals...), m_value(val) {}
 
-        T getValue() { return m_value; }
+        T getValue() const { return m_value; }
 
         template<Size index>
         auto get() {
@@ -48,5 +52,14 @@ namespace Cedar::Core::Container {
                 return Tuple<Ts...>::template get<index - 1>();
             }
         }
+
+        Boolean operator==(const Tuple& other) const {
+            return m_value == other.m_value &&
+                   static_cast<const Tuple<Ts...>&>(*this) == static_cast<const Tuple<Ts...>&>(other);
+        }
+
+        Boolean operator!=(const Tuple& other) const {
+            return !(*this == other);
+        }
     };
 }
@@ -0,0 +1,117 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Container/Pair.h>
+#include <Cedar/Core/Container/Tuple.h>
+
+namespace Cedar::Core::Hashing {
+    constexpr UInt64 Secret0 = 0x2D358DCCAA6C78A5ULL;
+    constexpr UInt64 Secret1 = 0x8BB84B93962EACC9ULL;
+    constexpr UInt64 Secret2 = 0x4B33A62ED433D4A3ULL;
+    constexpr UInt64 Secret3 = 0x4D5A2DA51DE1AA47ULL;
+
+    // Multiplies a by b into 128 bits and folds the halves together.
+    inline UInt64 multiplyFold(UInt64 a, UInt64 b) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        return static_cast<UInt64>(product) ^ static_cast<UInt64>(product >> 64);
+#else
+        UInt64 aHigh = a >> 32, aLow = static_cast<UInt32>(a);
+        UInt64 bHigh = b >> 32, bLow = static_cast<UInt32>(b);
+        UInt64 high = aHigh * bHigh, middle0 = aHigh * bLow, middle1 = aLow * bHigh, low = aLow * bLow;
+        UInt64 carry = ((low >> 32) + static_cast<UInt32>(middle0) + static_cast<UInt32>(middle1)) >> 32;
+        UInt64 productLow = low + (middle0 << 32) + (middle1 << 32);
+        UInt64 productHigh = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+        return productLow ^ productHigh;
+#endif
+    }
+
+    // Finalizer for integer keys: every input bit affects every output bit, so tables can mask the low bits.
+    inline UInt64 mix(UInt64 value) {
+        return multiplyFold(value ^ Secret0, Secret1);
+    }
+
+    // Hashes a byte range with a wyhash-style function.
+    UInt64 hashBytes(ConstPointer data, Size size, UInt64 seed = 0);
+
+    // Combines already-hashed values in order, for keys made of several fields.
+    class Hasher {
+    public:
+        explicit Hasher(UInt64 seed = 0) : m_state(seed ^ Secret2) {}
+
+        Hasher& add(Hash value) {
+            m_state = multiplyFold(m_state ^ value, Secret1) + Secret3;
+            return *this;
+        }
+
+        Hasher& addBytes(ConstPointer data, Size size) {
+            return add(static_cast<Hash>(hashBytes(data, size, m_state)));
+        }
+
+        [[nodiscard]] Hash finish() const {
+            return static_cast<Hash>(mix(m_state));
+        }
+
+    private:
+        UInt64 m_state;
+    };
+}
+
+namespace Cedar::Core {
+    // Hash functor used by the hash containers. It forwards to hash<T>; unlike that function template it can be
+    // partially specialised, which is how composite keys such as Pair and Tuple are supported.
+    template<typename T>
+    struct KeyHash {
+        Hash operator()(const T& value) const {
+            return hash<T>(value);
+        }
+    };
+
+    template<typename T1, typename T2>
+    struct KeyHash<Container::Pair<T1, T2>> {
+        Hash operator()(const Container::Pair<T1, T2>& pair) const {
+            return Hashing::Hasher().add(KeyHash<T1>()(pair.first)).add(KeyHash<T2>()(pair.second)).finish();
+        }
+    };
+
+    template<typename... Ts>
+    struct KeyHash<Container::Tuple<Ts...>> {
+        Hash operator()(const Container::Tuple<Ts...>& tuple) const {
+            Hashing::Hasher hasher;
+            addElements(hasher, tuple);
+            return hasher.finish();
+        }
+
+    private:
+        static void addElements(Hashing::Hasher&, const Container::Tuple<>&) {}
+
+        template<typename T, typename... Rest>
+        static void addElements(Hashing::Hasher& hasher, const Container::Tuple<T, Rest...>& tuple) {
+            hasher.add(KeyHash<T>()(tuple.getValue()));
+            addElements(hasher, static_cast<const Container::Tuple<Rest...>&>(tuple));
+        }
+    };
+}
@@ -56,3 +56,9 @@ namespace Cedar::Core::IO {
         Impl* pImpl;
     };
 }
+
+namespace Cedar::Core::TypeTraits {
+    // Path is a pImpl handle, so moving its bytes moves the path.
+    template<>
+    struct IsTriviallyRelocatable<IO::Path> : TrueType {};
+}
@@ -28,13 +28,16 @@
 #include <Cedar/Core/Exceptions/OutOfMemoryException.h>
 
 namespace Cedar::Core::Memory {
-    void copy(Pointer target, Pointer source, Size size);
+    void copy(Pointer target, ConstPointer source, Size size);
+
+    // Like copy, but the ranges may overlap.
+    void move(Pointer target, ConstPointer source, Size size);
 
     void copyCString(CString target, CString source);
 
     Size calcCStringLength(CString string);
 
-    Int32 compare(Pointer p1, Pointer p2, Size size);
+    Int32 compare(ConstPointer p1, ConstPointer p2, Size size);
 
     Pointer allocate(Size size);
 
@@ -68,6 +71,28 @@ namespace Cedar::Core::Memory {
         }
     };
 
+    // Moves count objects from source into uninitialised memory at target, leaving source uninitialised. The ranges may
+    // overlap. Trivially relocatable types are moved with a single memmove.
+    template<typename T>
+    void relocate(T* target, T* source, Size count) {
+        if (count == 0 || target == source) {
+            return;
+        }
+        if constexpr (TypeTraits::IsTriviallyRelocatable<T>::value) {
+            Memory::move(target, source, count * sizeof(T));
+        } else if (target < source) {
+            for (Size i = 0; i < count; ++i) {
+                new (target + i) T(TypeTraits::move(source[i]));
+                source[i].~T();
+            }
+        } else {
+            for (Size i = count; i-- > 0;) {
+                new (target + i) T(TypeTraits::move(source[i]));
+                source[i].~T();
+            }
+        }
+    }
+
     template<typename T>
     class UniquePointer {
     public:
@@ -89,6 +114,10 @@ namespace Cedar::Core::Memory {
             return *this;
         }
 
+        ~UniquePointer() {
+            delete m_pointer;
+        }
+
         T& operator*() const { return *m_pointer; }
         T* operator->() const { return m_pointer; }
         T* get() const { return m_pointer; }
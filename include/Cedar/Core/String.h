@@ -24,6 +24,7 @@
 #pragma once
 
 #include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/TypeTraits.h>
 
 namespace Cedar::Core {
     namespace Container {
@@ -61,9 +62,15 @@ namespace Cedar::Core {
         [[nodiscard]] String substring(Size start, Size len = NPos) const;
         [[nodiscard]] String replace(const String& oldStr, const String& newStr) const;
 
+        [[nodiscard]] String toUpperCase() const;
+        [[nodiscard]] String toLowerCase() const;
+        [[nodiscard]] String caseFold() const;
+
         [[nodiscard]] Boolean contains(const String& substring) const;
         [[nodiscard]] Boolean startsWith(const String& prefix) const;
         [[nodiscard]] Boolean endsWith(const String& suffix) const;
+        [[nodiscard]] Boolean equalsIgnoreCase(const String& other) const;
+        [[nodiscard]] Int32 compareIgnoreCase(const String& other) const;
 
         [[nodiscard]] Container::List<String> split(const String& delimiter) const;
         [[nodiscard]] Container::List<String> getLines() const;
@@ -82,28 +89,113 @@ namespace Cedar::Core {
 
         [[nodiscard]] Container::Array<wchar_t> toWCString() const;
 
+        // Hash of the UTF-8 bytes, equal to hash<StringView> of the same text; heap strings compute it once.
+        [[nodiscard]] Hash hashCode() const;
+
         static const SSize NPos = -1;
 
-// TODO
-//        class Iterator {
-//        public:
-//            Iterator(const Byte* ptr, const Byte* end);
-//            Iterator& operator++();
-//            Iterator operator++(int);
-//            Rune operator*() const ;
-//            Boolean operator!=(const Iterator& other) const;
-//            Boolean operator==(const Iterator& other) const;
-//        private:
-//            const Byte* ptr;
-//            const Byte* end;
-//        };
-//        Iterator begin() const;
-//        Iterator end() const;
+        // Bidirectional iterator over the runes of a String; it stays valid while the String is neither modified nor moved.
+        class Iterator {
+        public:
+            explicit Iterator(const Byte* ptr) : m_ptr(ptr) {}
+
+            Iterator& operator++() {
+                Byte lead = *m_ptr;
+                m_ptr += lead < 0x80 ? 1 : 2 + (lead >= 0xE0) + (lead >= 0xF0);
+                return *this;
+            }
+
+            Iterator operator++(Int32) {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            Iterator& operator--() {
+                do {
+                    --m_ptr;
+                } while ((*m_ptr & 0xC0) == 0x80);
+                return *this;
+            }
+
+            Iterator operator--(Int32) {
+                Iterator tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            Rune operator*() const {
+                Byte lead = m_ptr[0];
+                if (lead < 0x80) return lead;
+
+                // 110xxxxx, 1110xxxx and 11110xxx leads carry one, two and three continuation bytes.
+                UInt32 extra = 1 + (lead >= 0xE0) + (lead >= 0xF0);
+                Rune rune = lead & (0x3F >> extra);
+                for (UInt32 i = 1; i <= extra; ++i) {
+                    rune = (rune << 6) | (m_ptr[i] & 0x3F);
+                }
+                return rune;
+            }
+
+            Boolean operator==(const Iterator& other) const {
+                return m_ptr == other.m_ptr;
+            }
+
+            Boolean operator!=(const Iterator& other) const {
+                return m_ptr != other.m_ptr;
+            }
+
+        private:
+            const Byte* m_ptr;
+        };
+
+        [[nodiscard]] Iterator begin() const;
+        [[nodiscard]] Iterator end() const;
+
+        // Decodes up to max runes starting at rune startIndex into out and returns how many were written.
+        Size decodeRunes(Rune* out, Size max, Size startIndex = 0) const;
 
     private:
+        friend class StringBuilder;
+        friend class StringView;
+
         struct Impl;
-        Impl* pImpl;
+
+        // Strings of up to InlineCapacity bytes are stored in the object itself and never touch the heap.
+        static constexpr Size InlineCapacity = 28;
+
+        enum class Storage : Byte {
+            Inline,
+            Heap,
+            MovedFrom
+        };
+
+        union {
+            Impl* pImpl;
+            Byte m_inline[InlineCapacity + 1];
+        };
+        Byte m_inlineSize;
+        Byte m_inlineRuneCount;
+        Storage m_storage;
 
         void checkValidState() const;
+
+        [[nodiscard]] const Byte* bytes() const;
+        [[nodiscard]] Size byteSize() const;
+        [[nodiscard]] Size byteOffsetOf(Size runeIndex) const;
+
+        void initialize(const Byte* str, Size len);
+        Byte* initializeUninitialized(Size len, Size runeCount);
+        void adoptBuffer(Byte* buffer, Size len, Size runeCount);
+        void release();
+
+        [[nodiscard]] String mapCase(Rune (*mapRune)(Rune), Size (*mapAscii)(const Byte*, Byte*, Size)) const;
     };
+
+    template<>
+    Hash hash<String>(const String& value);
+
+    // Neither the inline bytes nor the Impl pointer refer back to the String object itself.
+    template<>
+    struct TypeTraits::IsTriviallyRelocatable<String> : TypeTraits::TrueType {};
 }
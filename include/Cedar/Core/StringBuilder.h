@@ -0,0 +1,67 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Memory.h>
+#include <Cedar/Core/String.h>
+
+namespace Cedar::Core {
+    // Accumulates UTF-8 text in a geometrically growing buffer and hands it to a String without copying.
+    class StringBuilder {
+    public:
+        StringBuilder();
+        explicit StringBuilder(Size initialCapacity);
+        StringBuilder(StringBuilder&& other) noexcept;
+        ~StringBuilder();
+
+        StringBuilder(const StringBuilder&) = delete;
+        StringBuilder& operator=(const StringBuilder&) = delete;
+        StringBuilder& operator=(StringBuilder&& other) noexcept;
+
+        StringBuilder& append(const String& str);
+        StringBuilder& append(CString str);
+        StringBuilder& append(CString str, Size len);
+        StringBuilder& append(Rune rune);
+
+        void reserve(Size capacity);
+        void clear();
+
+        [[nodiscard]] Size length() const;
+        [[nodiscard]] Size rawLength() const;
+        [[nodiscard]] Size capacity() const;
+
+        // Moves the accumulated text into a String and leaves the builder empty.
+        [[nodiscard]] String build();
+
+    private:
+        Memory::UniquePointer<Byte[]> m_buffer;
+        Size m_size;
+        Size m_capacity;
+        Size m_runeCount;
+
+        Byte* grow(Size additional);
+        void appendBytes(const Byte* data, Size len, Size runeCount);
+    };
+}
@@ -0,0 +1,92 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/String.h>
+#include <Cedar/Core/StringView.h>
+
+namespace Cedar::Core {
+    // Compact handle to text interned in a StringPool. Two symbols from the same pool are equal exactly when their
+    // text is. The default symbol is the empty string, which every pool interns first.
+    class Symbol {
+    public:
+        constexpr Symbol() : m_id(0) {}
+        constexpr explicit Symbol(UInt32 id) : m_id(id) {}
+
+        [[nodiscard]] constexpr UInt32 id() const {
+            return m_id;
+        }
+
+        constexpr Boolean operator==(Symbol other) const {
+            return m_id == other.m_id;
+        }
+
+        constexpr Boolean operator!=(Symbol other) const {
+            return m_id != other.m_id;
+        }
+
+        constexpr Boolean operator<(Symbol other) const {
+            return m_id < other.m_id;
+        }
+
+    private:
+        UInt32 m_id;
+    };
+
+    template<>
+    Hash hash<Symbol>(const Symbol& value);
+
+    // Thread-safe string interning. Text is copied once into arena chunks owned by the pool and never moves, so the
+    // views handed out stay valid for the lifetime of the pool. Interning text that is already present takes no locks.
+    class StringPool {
+    public:
+        StringPool();
+        ~StringPool();
+
+        StringPool(const StringPool&) = delete;
+        StringPool& operator=(const StringPool&) = delete;
+
+        Symbol intern(StringView text);
+
+        // Looks text up without interning it.
+        Boolean find(StringView text, Symbol& symbol) const;
+
+        [[nodiscard]] StringView view(Symbol symbol) const;
+        [[nodiscard]] String toString(Symbol symbol) const;
+
+        // Number of distinct strings interned, including the empty string.
+        [[nodiscard]] Size size() const;
+
+        // Bytes held by the arena, excluding the lookup index.
+        [[nodiscard]] Size arenaSize() const;
+
+        // Process-wide pool for symbols that are shared between unrelated subsystems.
+        static StringPool& global();
+
+    private:
+        struct Impl;
+        Impl* pImpl;
+    };
+}
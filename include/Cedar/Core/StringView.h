@@ -0,0 +1,116 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/String.h>
+
+namespace Cedar::Core {
+    // Non-owning window over UTF-8 text. The viewed buffer must outlive the view.
+    class StringView {
+    public:
+        StringView();
+
+        //NOLINTNEXTLINE
+        StringView(CString str);
+        StringView(CString str, Size len);
+        //NOLINTNEXTLINE
+        StringView(const String& str);
+
+        [[nodiscard]] Size length() const;
+        [[nodiscard]] Size rawLength() const;
+        [[nodiscard]] CString rawData() const;
+        [[nodiscard]] Boolean isEmpty() const;
+
+        [[nodiscard]] StringView trim() const;
+        [[nodiscard]] StringView trimStart() const;
+        [[nodiscard]] StringView trimEnd() const;
+        [[nodiscard]] StringView stripPrefix(StringView prefix) const;
+        [[nodiscard]] StringView stripSuffix(StringView suffix) const;
+
+        [[nodiscard]] Boolean contains(StringView substring) const;
+        [[nodiscard]] Boolean startsWith(StringView prefix) const;
+        [[nodiscard]] Boolean endsWith(StringView suffix) const;
+
+        Boolean operator==(StringView other) const;
+        Boolean operator!=(StringView other) const;
+
+        [[nodiscard]] String toString() const;
+
+        class SplitRange;
+
+        [[nodiscard]] SplitRange split(StringView delimiter) const;
+        [[nodiscard]] SplitRange lines() const;
+
+    private:
+        friend class StringPool;
+
+        static constexpr Size UnknownLength = static_cast<Size>(-1);
+
+        const Byte* m_data;
+        Size m_size;
+        mutable Size m_runeCount;
+
+        StringView(const Byte* data, Size size, Size runeCount);
+
+        [[nodiscard]] Boolean isAsciiOnly() const;
+        [[nodiscard]] StringView slice(Size from, Size to) const;
+    };
+
+    // Yields the pieces between delimiters one at a time, with the same rules as String::split.
+    class StringView::SplitRange {
+    public:
+        class Iterator {
+        public:
+            Iterator(const Byte* current, const Byte* end, StringView delimiter, Boolean asciiOnly);
+
+            StringView operator*() const;
+            Iterator& operator++();
+            Boolean operator==(const Iterator& other) const;
+            Boolean operator!=(const Iterator& other) const;
+
+        private:
+            const Byte* m_current;
+            const Byte* m_end;
+            StringView m_delimiter;
+            StringView m_segment;
+            Boolean m_asciiOnly;
+            Boolean m_done;
+
+            void advance();
+        };
+
+        SplitRange(StringView text, StringView delimiter);
+
+        [[nodiscard]] Iterator begin() const;
+        [[nodiscard]] Iterator end() const;
+
+    private:
+        StringView m_text;
+        StringView m_delimiter;
+    };
+
+    template<>
+    Hash hash<StringView>(const StringView& value);
+}
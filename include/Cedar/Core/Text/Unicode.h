@@ -27,17 +27,34 @@
 #include <Cedar/Core/String.h>
 
 namespace Cedar::Core::Text {
+    // Unicode general categories; Cn covers unassigned code points and anything above U+10FFFF.
+    enum class GeneralCategory : Byte {
+        Cn,
+        Lu, Ll, Lt, Lm, Lo,
+        Mn, Mc, Me,
+        Nd, Nl, No,
+        Pc, Pd, Ps, Pe, Pi, Pf, Po,
+        Sm, Sc, Sk, So,
+        Zs, Zl, Zp,
+        Cc, Cf, Cs, Co
+    };
+
     class Unicode {
     public:
+        static GeneralCategory generalCategory(Rune codepoint);
+
         static Boolean isLetter(Rune codepoint);
         static Boolean isDigit(Rune codepoint);
         static Boolean isSpace(Rune codepoint);
 
         static Rune toUpperCase(Rune codepoint);
         static Rune toLowerCase(Rune codepoint);
+        static Rune caseFold(Rune codepoint);
 
         static Size calculateRuneLength(Byte firstByte);
         static Rune extractRuneAt(const Byte *data, Size i);
+        static Size encodeRune(Rune codepoint, Byte *buffer);
+        // U+0000 encodes to a one-byte string holding a NUL, not to an empty string.
         static String encodeRuneToString(Rune codepoint);
     };
 }
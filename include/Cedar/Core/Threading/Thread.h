@@ -40,6 +40,9 @@ namespace Cedar::Core::Threading {
         void start();
         void join();
         void detach();
+
+        // Gives up the rest of the calling thread's time slice.
+        static void yield();
     private:
         struct Impl;
         Memory::SharedPointer<Impl> pImpl;
@@ -156,6 +156,84 @@ namespace Cedar::Core::TypeTraits {
     template<typename T>
     using ToDecay = typename Decay<T>::Type;
 
+    template<typename T, typename U>
+    struct IsSame : FalseType {};
+
+    template<typename T>
+    struct IsSame<T, T> : TrueType {};
+
+    template<Boolean B, typename T = void>
+    struct EnableIf {};
+
+    template<typename T>
+    struct EnableIf<true, T> { typedef T Type; };
+
+    template<typename T>
+    struct IsIntegralHelper : FalseType {};
+
+    template<>
+    struct IsIntegralHelper<bool> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<char> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<signed char> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<unsigned char> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<wchar_t> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<char16_t> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<char32_t> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<short> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<unsigned short> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<int> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<unsigned int> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<long> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<unsigned long> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<long long> : TrueType {};
+
+    template<>
+    struct IsIntegralHelper<unsigned long long> : TrueType {};
+
+    template<typename T>
+    struct IsIntegral : IsIntegralHelper<typename RemoveCV<T>::type> {};
+
+    template<typename T>
+    struct IsTriviallyCopyable : IntegralConstant<Boolean, __is_trivially_copyable(T)> {};
+
+    template<typename T>
+    struct IsNothrowMoveConstructible : IntegralConstant<Boolean, __is_nothrow_constructible(T, T&&)> {};
+
+    template<typename T>
+    struct IsNothrowMoveAssignable : IntegralConstant<Boolean, __is_nothrow_assignable(T&, T&&)> {};
+
+    // Types whose objects may be moved to a new address by copying their bytes and then forgetting the old ones,
+    // without running a move constructor or destructor. Trivially copyable types qualify automatically; classes
+    // that only hold a pointer to their state, like the pImpl types, opt in by specialising this trait.
+    template<typename T>
+    struct IsTriviallyRelocatable : IsTriviallyCopyable<T> {};
+
     template<typename T>
     typename RemoveReference<T>::Type&& move(T&& arg) {
         return static_cast<typename RemoveReference<T>::Type&&>(arg);
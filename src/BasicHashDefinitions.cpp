@@ -22,71 +22,75 @@
  */
 
 #include <Cedar/Core/BasicTypes.h>
+#include <Cedar/Core/Hashing.h>
 
 namespace Cedar::Core {
     template<>
     Hash hash<Int8>(const Int8 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<Int16>(const Int16 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<Int32>(const Int32 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<Int64>(const Int64 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<UInt8>(const UInt8 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<UInt16>(const UInt16 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<UInt32>(const UInt32 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<UInt64>(const UInt64 &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<Float32>(const Float32 &val) {
-        return *reinterpret_cast<const UInt32 *>(&val);
+        // +0.0 and -0.0 compare equal, so they must hash alike.
+        Float32 normalized = val == 0 ? 0.0f : val;
+        return static_cast<Hash>(Hashing::mix(*reinterpret_cast<const UInt32 *>(&normalized)));
     }
 
     template<>
     Hash hash<Float64>(const Float64 &val) {
-        return *reinterpret_cast<const UInt64 *>(&val);
+        Float64 normalized = val == 0 ? 0.0 : val;
+        return static_cast<Hash>(Hashing::mix(*reinterpret_cast<const UInt64 *>(&normalized)));
     }
 
     template<>
     Hash hash<Boolean>(const Boolean &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 
     template<>
     Hash hash<Pointer>(const Pointer &val) {
         auto ptrVal = reinterpret_cast<Size>(val);
-        return static_cast<Hash>(ptrVal);
+        return static_cast<Hash>(Hashing::mix(ptrVal));
     }
 
     template<>
     Hash hash<Rune>(const Rune &val) {
-        return static_cast<Hash>(val);
+        return static_cast<Hash>(Hashing::mix(static_cast<UInt64>(val)));
     }
 }
@@ -0,0 +1,91 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Cedar/Core/Hashing.h>
+
+#include <cstring>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Hashing;
+
+static UInt64 read64(const Byte* p) {
+    UInt64 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static UInt64 read32(const Byte* p) {
+    UInt32 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Reads one to three bytes without going past the end.
+static UInt64 readSmall(const Byte* p, Size size) {
+    return (static_cast<UInt64>(p[0]) << 16) | (static_cast<UInt64>(p[size >> 1]) << 8) | p[size - 1];
+}
+
+// Follows the structure of wyhash: 48-byte blocks feed three independent lanes, the tail is read with overlapping loads.
+UInt64 Hashing::hashBytes(ConstPointer data, Size size, UInt64 seed) {
+    const auto* p = static_cast<const Byte*>(data);
+    seed ^= multiplyFold(seed ^ Secret0, Secret1);
+
+    UInt64 a;
+    UInt64 b;
+    if (size <= 16) {
+        if (size >= 4) {
+            Size middle = (size >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + middle);
+            b = (read32(p + size - 4) << 32) | read32(p + size - 4 - middle);
+        } else if (size > 0) {
+            a = readSmall(p, size);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        Size remaining = size;
+        if (remaining > 48) {
+            UInt64 lane1 = seed;
+            UInt64 lane2 = seed;
+            do {
+                seed = multiplyFold(read64(p) ^ Secret1, read64(p + 8) ^ seed);
+                lane1 = multiplyFold(read64(p + 16) ^ Secret2, read64(p + 24) ^ lane1);
+                lane2 = multiplyFold(read64(p + 32) ^ Secret3, read64(p + 40) ^ lane2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = multiplyFold(read64(p) ^ Secret1, read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+
+    return multiplyFold(multiplyFold(a ^ Secret1, b ^ seed) ^ Secret0 ^ size, Secret1);
+}
@@ -22,6 +22,8 @@
  */
 
 #include <Cedar/Core/IO/Path.h>
+#include <Cedar/Core/StringBuilder.h>
+#include <Cedar/Core/Container/InlineArrayList.h>
 
 using namespace Cedar::Core;
 using namespace Cedar::Core::Container;
@@ -29,15 +31,45 @@ using namespace Cedar::Core::IO;
 
 const String pathSeparator = "/";
 
+// Converts backslashes to slashes and collapses repeated separators, keeping a leading "//" intact.
 static String normalize(const String& path) {
-    String normalizedPath = path.replace("\\", "/");
+    CString data = path.rawString();
+    Size size = path.rawLength();
+
+    StringBuilder builder(size);
+    Size runStart = 0;
+    for (Size i = 0; i < size; ++i) {
+        if (data[i] != '/' && data[i] != '\\') {
+            continue;
+        }
+        Size runEnd = i;
+        while (runEnd < size && (data[runEnd] == '/' || data[runEnd] == '\\')) ++runEnd;
 
-    Size pos = 0;
-    while ((pos = normalizedPath.find("//", pos + 2)) != String::NPos) {
-        normalizedPath = normalizedPath.substring(0, pos) + normalizedPath.substring(pos + 1);
+        builder.append(data + runStart, i - runStart);
+        builder.append(i == 0 && runEnd >= 2 ? "//" : "/");
+        runStart = runEnd;
+        i = runEnd - 1;
+    }
+    builder.append(data + runStart, size - runStart);
+    return builder.build();
+}
+
+// Rune positions at which each non-empty component of path ends. Few paths are deeper than the inline capacity.
+static InlineArrayList<Size, 8> componentEnds(const String& path) {
+    InlineArrayList<Size, 8> ends;
+    Size start = 0, end;
+
+    while ((end = path.find(pathSeparator, start)) != String::NPos) {
+        if (end != start) {
+            ends.append(end);
+        }
+        start = end + 1;
     }
 
-    return normalizedPath;
+    if (start < path.length()) {
+        ends.append(path.length());
+    }
+    return ends;
 }
 
 struct Path::Impl {
@@ -100,21 +132,9 @@ Size Path::calculateDepth() const {
 
 List<Path> Path::decomposeList() const {
     List<Path> parts;
-    Size start = 0, end;
-
-    while ((end = pImpl->path.find(pathSeparator, start)) != String::NPos) {
-        if (end != start) {
-            String part = pImpl->path.substring(0, end);
-            parts.append(Path(part));
-        }
-        start = end + 1;
-    }
-
-    if (start < pImpl->path.length()) {
-        String part = pImpl->path.substring(0, pImpl->path.length());
-        parts.append(Path(part));
+    for (Size end : componentEnds(pImpl->path)) {
+        parts.append(Path(pImpl->path.substring(0, end)));
     }
-
     return parts;
 }
 
@@ -136,7 +156,7 @@ Path& Path::operator=(Path&& other) noexcept {
 }
 
 Path Path::operator[](Size index) const {
-    return this->decomposeList()[index];
+    return Path(pImpl->path.substring(0, componentEnds(pImpl->path)[index]));
 }
 
 String Path::toString() const {
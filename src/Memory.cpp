@@ -28,11 +28,15 @@
 
 using namespace Cedar::Core;
 
-void Memory::copy(Cedar::Core::Pointer target, Cedar::Core::Pointer source, Cedar::Core::Size size) {
+void Memory::copy(Cedar::Core::Pointer target, Cedar::Core::ConstPointer source, Cedar::Core::Size size) {
     memcpy(target, source, size);
 }
 
-Int32 Memory::compare(Pointer p1, Pointer p2, Size size) {
+void Memory::move(Pointer target, ConstPointer source, Size size) {
+    memmove(target, source, size);
+}
+
+Int32 Memory::compare(ConstPointer p1, ConstPointer p2, Size size) {
     return memcmp(p1, p2, size);
 }
 
@@ -22,7 +22,11 @@
  */
 
 #include <Cedar/Core/String.h>
+#include <Cedar/Core/StringBuilder.h>
+#include <Cedar/Core/StringView.h>
 #include <Cedar/Core/Memory.h>
+#include <Cedar/Core/Hashing.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
 #include <Cedar/Core/Exceptions/InvalidStateException.h>
 #include <Cedar/Core/Exceptions/OutOfRangeException.h>
 #include <Cedar/Core/Container/List.h>
@@ -30,93 +34,184 @@
 
 #include <Cedar/Core/Text/Unicode.h>
 
+#include "./Text/AsciiCase.h"
+#include "./Text/StringSearch.h"
+#include "./Text/Utf8.h"
+
+#include <atomic>
+
 using namespace Cedar::Core;
 using namespace Cedar::Core::Container;
 using namespace Cedar::Core::Text;
 
-// Internal implementation class for encapsulating string data and operations
+// Heap representation used once a string outgrows the inline buffer
 struct String::Impl {
-    Memory::UniquePointer<Byte[]> data; // Pointer to string data
-    Size size;                          // Byte length of the string
-    Size runeCount;                     // Count of Unicode runes in the string
+    // One rune index checkpoint is recorded every RuneIndexStride runes.
+    static constexpr Size RuneIndexStride = 32;
 
-    Impl() : size(0), runeCount(0) {}
+    Memory::UniquePointer<Byte[]> data;         // Pointer to string data
+    Size size;                                  // Byte length of the string
+    Size runeCount;                             // Count of Unicode runes in the string
+    mutable std::atomic<Size*> runeIndex{};     // Byte offsets of every RuneIndexStride-th rune, built on first use
+    mutable std::atomic<Hash> cachedHash{};     // hashCode() once computed, zero until then
 
-    Impl(CString str, Size len) : size(len), runeCount(0) {
-        str = str ? str : "";
+    Impl(Size len, Size runes) : size(len), runeCount(runes) {
         data.reset(static_cast<Byte *>(Memory::allocate(len + 1)));
-        Memory::copy(data.get(), (Byte *) str, len);
         data[len] = '\0'; // Null terminate for safety
-        calculateRuneCount();
     }
 
-    Impl(const Impl& other) : size(other.size), runeCount(other.runeCount) {
-        if (size >= 0) {
-            data.reset(static_cast<Byte*>(Memory::allocate(size + 1)));
-            Memory::copy(data.get(), other.data.get(), size);
-            data[size] = '\0';
-        }
-    }
+    // Takes ownership of a null-terminated buffer allocated with new Byte[].
+    Impl(Byte* buffer, Size len, Size runes) : data(buffer), size(len), runeCount(runes) {}
 
-    ~Impl() = default;
+    Impl(const Impl& other) : Impl(other.size, other.runeCount) {
+        Memory::copy(data.get(), other.data.get(), size);
+        cachedHash.store(other.cachedHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
 
-    void checkValidState() const {
-        if (!data.get()) throw InvalidStateException("Invalid state: object has been moved or is uninitialized.");
+    ~Impl() {
+        delete[] runeIndex.load(std::memory_order_relaxed);
     }
 
-    void calculateRuneCount() {
-        runeCount = 0;
-        for (Size i = 0; i < size; i += Unicode::calculateRuneLength(data[i])) {
-            ++runeCount;
+    Impl& operator=(const Impl& other) = delete;
+
+    // Returns the checkpoint table, building it if this is the first indexed access.
+    const Size* checkpoints() const {
+        Size* index = runeIndex.load(std::memory_order_acquire);
+        if (index) return index;
+
+        auto* built = new Size[runeCount / RuneIndexStride + 1];
+        Size rune = 0;
+        for (Size i = 0; i < size; i += Unicode::calculateRuneLength(data[i]), ++rune) {
+            if (rune % RuneIndexStride == 0) {
+                built[rune / RuneIndexStride] = i;
+            }
+        }
+        if (rune % RuneIndexStride == 0) {
+            built[rune / RuneIndexStride] = size;
         }
-    }
 
-    Impl& operator=(const Impl& other) {
-        if (this != &other) {
-            data.reset(new Byte[other.size + 1]);
-            Memory::copy(data.get(), other.data.get(), other.size + 1);
-            size = other.size;
-            runeCount = other.runeCount;
+        // Another reader may have raced us here; keep whichever table was published first.
+        if (!runeIndex.compare_exchange_strong(index, built, std::memory_order_acq_rel)) {
+            delete[] built;
+            return index;
         }
-        return *this;
+        return built;
     }
 };
 
-String::String() : pImpl(new Impl("", 0)) {}
+String::String() : m_inline{}, m_inlineSize(0), m_inlineRuneCount(0), m_storage(Storage::Inline) {}
 
 String::String(CString str) : String(str, Memory::calcCStringLength(str)) {}
 
-String::String(CString str, Size len) : pImpl(new Impl(str, len)) {}
+String::String(CString str, Size len) : String() {
+    initialize(reinterpret_cast<const Byte*>(str ? str : ""), str ? len : 0);
+}
 
 String::String(const Container::Array<Byte>& byteArray): String(reinterpret_cast<CString>(byteArray.data()), byteArray.size()) {}
 
 String::String(Rune rune): String(Unicode::encodeRuneToString(rune)) {}
 
-String::String(const String& other) : pImpl(new Impl(*other.pImpl)) {}
+String::String(const String& other) : String() {
+    other.checkValidState();
+    if (other.m_storage == Storage::Inline) {
+        Memory::copy(m_inline, other.m_inline, other.m_inlineSize + 1);
+        m_inlineSize = other.m_inlineSize;
+        m_inlineRuneCount = other.m_inlineRuneCount;
+    } else {
+        pImpl = new Impl(*other.pImpl);
+        m_storage = Storage::Heap;
+    }
+}
 
-String::String(String&& other) noexcept : pImpl(std::move(other.pImpl)) {
-    other.pImpl = nullptr;
+String::String(String&& other) noexcept : String() {
+    *this = TypeTraits::move(other);
 }
 
 String::~String() {
-    delete pImpl;
+    release();
 }
 
 void String::checkValidState() const {
-    if (!pImpl)
+    if (m_storage == Storage::MovedFrom)
         throw InvalidStateException("Attempt to use a moved-from String object.");
-    pImpl->checkValidState();
+}
+
+const Byte* String::bytes() const {
+    return m_storage == Storage::Heap ? pImpl->data.get() : m_inline;
+}
+
+Size String::byteSize() const {
+    return m_storage == Storage::Heap ? pImpl->size : m_inlineSize;
+}
+
+// Maps a rune index in [0, length()] to its byte offset.
+Size String::byteOffsetOf(Size runeIndex) const {
+    const Byte* data = bytes();
+    Size size = byteSize();
+    if (size == length()) {
+        return runeIndex; // ASCII only, runes and bytes coincide
+    }
+
+    Size offset = 0;
+    Size remaining = runeIndex;
+    if (m_storage == Storage::Heap && runeIndex >= Impl::RuneIndexStride) {
+        offset = pImpl->checkpoints()[runeIndex / Impl::RuneIndexStride];
+        remaining = runeIndex % Impl::RuneIndexStride;
+    }
+    for (; remaining > 0 && offset < size; --remaining) {
+        offset += Unicode::calculateRuneLength(data[offset]);
+    }
+    return offset;
+}
+
+void String::initialize(const Byte* str, Size len) {
+    Size runeCount = 0;
+    if (!Utf8::validate(str, len, runeCount)) {
+        throw InvalidArgumentException("Malformed UTF-8 sequence");
+    }
+    Memory::copy(initializeUninitialized(len, runeCount), str, len);
+}
+
+// Sets up storage for `len` bytes and returns the buffer for the caller to fill; the terminator is already in place.
+Byte* String::initializeUninitialized(Size len, Size runeCount) {
+    release();
+    if (len <= InlineCapacity) {
+        m_inline[len] = '\0';
+        m_inlineSize = static_cast<Byte>(len);
+        m_inlineRuneCount = static_cast<Byte>(runeCount);
+        m_storage = Storage::Inline;
+        return m_inline;
+    }
+    pImpl = new Impl(len, runeCount);
+    m_storage = Storage::Heap;
+    return pImpl->data.get();
+}
+
+void String::adoptBuffer(Byte* buffer, Size len, Size runeCount) {
+    release();
+    pImpl = new Impl(buffer, len, runeCount);
+    m_storage = Storage::Heap;
+}
+
+void String::release() {
+    if (m_storage == Storage::Heap) {
+        delete pImpl;
+    }
+    m_inline[0] = '\0';
+    m_inlineSize = 0;
+    m_inlineRuneCount = 0;
+    m_storage = Storage::Inline;
 }
 
 Size String::length() const {
     checkValidState();
-    return pImpl->runeCount;
+    return m_storage == Storage::Heap ? pImpl->runeCount : m_inlineRuneCount;
 }
 
 Rune String::at(SSize index) const {
     checkValidState();
 
-    Size actualLength = this->length();
+    SSize actualLength = static_cast<SSize>(this->length());
     if (index < 0) {
         index += actualLength;
     }
@@ -124,60 +219,60 @@ Rune String::at(SSize index) const {
         throw OutOfRangeException("Index out of range");
     }
 
-    Size charCount = 0;
-    for (Size i = 0; i < pImpl->size; i += Unicode::calculateRuneLength(pImpl->data[i])) {
-        if (charCount == index) {
-            return Unicode::extractRuneAt(pImpl->data.get(), i);
-        }
-        charCount++;
-    }
-
-    return 0; // Should never reach here if checks are correct
+    return Unicode::extractRuneAt(bytes(), byteOffsetOf(index));
 }
 
 Rune String::operator[](SSize index) const {
     return this->at(index);
 }
 
-String String::trimStart() const {
+String::Iterator String::begin() const {
     checkValidState();
+    return Iterator(bytes());
+}
 
-    Size i = 0;
-    while (i < pImpl->size && Unicode::isSpace(pImpl->data[i])) {
-        i += Unicode::calculateRuneLength(pImpl->data[i]); // Advance by rune, not byte
-    }
-    return {reinterpret_cast<CString>(pImpl->data.get() + i), pImpl->size - i};
+String::Iterator String::end() const {
+    checkValidState();
+    return Iterator(bytes() + byteSize());
 }
 
-String String::trimEnd() const {
+Size String::decodeRunes(Rune* out, Size max, Size startIndex) const {
     checkValidState();
 
-    Size i = pImpl->size;
-    while (i > 0) {
-        Size prev = i - 1;
-        while (prev > 0 && (pImpl->data[prev] & 0xC0) == 0x80) prev--; // Move back to the start of the rune
-        if (!Unicode::isSpace(pImpl->data[prev])) break;
-        i = prev;
+    if (startIndex > length()) {
+        throw OutOfRangeException("Start index is out of range");
     }
-    return {reinterpret_cast<CString>(pImpl->data.get()), i};
+
+    Size offset = byteOffsetOf(startIndex);
+    Size consumed = 0;
+    return Utf8::decode(bytes() + offset, byteSize() - offset, out, max, consumed);
+}
+
+String String::trimStart() const {
+    checkValidState();
+    return StringView(*this).trimStart().toString();
+}
+
+String String::trimEnd() const {
+    checkValidState();
+    return StringView(*this).trimEnd().toString();
 }
 
 String String::trim() const {
-    return this->trimStart().trimEnd();
+    checkValidState();
+    return StringView(*this).trim().toString();
 }
 
 String String::stripPrefix(const String& prefix) const {
     if (this->startsWith(prefix)) {
-        Size newLen = pImpl->size - prefix.pImpl->size;
-        return {reinterpret_cast<CString>(pImpl->data.get() + prefix.pImpl->size), newLen};
+        return StringView(*this).stripPrefix(prefix).toString();
     }
     return *this;
 }
 
 String String::stripSuffix(const String& suffix) const {
     if (this->endsWith(suffix)) {
-        Size newLen = pImpl->size - suffix.pImpl->size;
-        return {reinterpret_cast<CString>(pImpl->data.get()), newLen};
+        return StringView(*this).stripSuffix(suffix).toString();
     }
     return *this;
 }
@@ -185,105 +280,181 @@ String String::stripSuffix(const String& suffix) const {
 String String::substring(Size start, Size len) const {
     checkValidState();
 
-    Size numRunes = 0, startPos = 0;
-    Size actualLength = 0;
-
-    for (Size i = 0; numRunes < start && i < pImpl->size; numRunes++) {
-        i += Unicode::calculateRuneLength(pImpl->data[i]);
-        startPos = i;
-    }
-
-    if (numRunes < start) {
+    Size runeCount = length();
+    if (start > runeCount) {
         throw OutOfRangeException("Start index is out of range");
     }
 
-    String result;
-    for (Size i = startPos; i < pImpl->size && (len == NPos || actualLength < len); actualLength++) {
-        Rune rune = Unicode::extractRuneAt(pImpl->data.get(), i);
-        result = result + String(rune);
-        i += Unicode::calculateRuneLength(pImpl->data[i]);
-    }
+    Size end = (len == static_cast<Size>(NPos) || len > runeCount - start) ? runeCount : start + len;
+    Size startPos = byteOffsetOf(start);
+    Size endPos = byteOffsetOf(end);
 
+    String result;
+    Byte* data = result.initializeUninitialized(endPos - startPos, end - start);
+    Memory::copy(data, bytes() + startPos, endPos - startPos);
     return result;
 }
 
 String String::replace(const String& oldStr, const String& newStr) const {
     checkValidState();
+    oldStr.checkValidState();
+    newStr.checkValidState();
 
-    if (oldStr.pImpl->size == 0) {
+    if (oldStr.byteSize() == 0) {
         return *this;
     }
 
-    String result;
-    Size start = 0;
-    Size foundPos = this->find(oldStr);
+    const Byte* current = bytes();
+    const Byte* end = current + byteSize();
+    const Byte* found = StringSearch::findFirst(current, end - current, oldStr.bytes(), oldStr.byteSize());
+    if (!found) {
+        return *this;
+    }
 
-    while (foundPos != NPos) {
-        result = result + this->substring(start, foundPos - start);
-        result = result + newStr;
-        start = foundPos + oldStr.length();
-        if (start >= this->length()) break;
-        foundPos = this->find(oldStr, start);
+    StringBuilder builder(byteSize());
+    while (found) {
+        builder.append(reinterpret_cast<CString>(current), found - current);
+        builder.append(newStr);
+        current = found + oldStr.byteSize();
+        found = StringSearch::findFirst(current, end - current, oldStr.bytes(), oldStr.byteSize());
     }
+    builder.append(reinterpret_cast<CString>(current), end - current);
+    return builder.build();
+}
 
-    if (start < this->length()) {
-        result = result + this->substring(start);
+String String::toUpperCase() const {
+    return mapCase(Unicode::toUpperCase, AsciiCase::toUpper);
+}
+
+String String::toLowerCase() const {
+    return mapCase(Unicode::toLowerCase, AsciiCase::toLower);
+}
+
+String String::caseFold() const {
+    return mapCase(Unicode::caseFold, AsciiCase::toLower);
+}
+
+// Case mapping is one rune to one rune, so only the byte length can change, and it grows by at most half.
+String String::mapCase(Rune (*mapRune)(Rune), Size (*mapAscii)(const Byte*, Byte*, Size)) const {
+    checkValidState();
+
+    const Byte* src = bytes();
+    Size size = byteSize();
+
+    // Short strings are converted on the stack; the output always keeps room for the rest of the input.
+    Byte local[InlineCapacity + InlineCapacity / 2 + 1];
+    Memory::UniquePointer<Byte[]> heap;
+    Byte* buffer = local;
+    Size capacity = sizeof(local) - 1;
+    if (size > capacity) {
+        capacity = size;
+        heap.reset(new Byte[capacity + 1]);
+        buffer = heap.get();
+    }
+
+    Size in = 0;
+    Size out = 0;
+    while (true) {
+        Size run = mapAscii(src + in, buffer + out, size - in);
+        in += run;
+        out += run;
+        if (in == size) break;
+
+        Byte encoded[4];
+        Size encodedLength = Unicode::encodeRune(mapRune(Unicode::extractRuneAt(src, in)), encoded);
+        in += Unicode::calculateRuneLength(src[in]);
+
+        if (capacity - out < encodedLength + (size - in)) {
+            Size remaining = size - in;
+            capacity = out + encodedLength + remaining + remaining / 2;
+            auto* grown = new Byte[capacity + 1];
+            Memory::copy(grown, buffer, out);
+            heap.reset(grown);
+            buffer = grown;
+        }
+        Memory::copy(buffer + out, encoded, encodedLength);
+        out += encodedLength;
+    }
+
+    String result;
+    if (buffer == local || out <= InlineCapacity) {
+        Memory::copy(result.initializeUninitialized(out, length()), buffer, out);
+    } else {
+        buffer[out] = '\0';
+        result.adoptBuffer(heap.release(), out, length());
     }
     return result;
 }
 
 Boolean String::contains(const String &substring) const {
-    return this->find(substring) != NPos;
+    checkValidState();
+    substring.checkValidState();
+
+    return StringSearch::findFirst(bytes(), byteSize(), substring.bytes(), substring.byteSize()) != nullptr;
 }
 
 Boolean String::startsWith(const String& prefix) const {
     checkValidState();
+    prefix.checkValidState();
 
-    if (prefix.pImpl->size > pImpl->size) return false;
-    return Memory::compare(pImpl->data.get(), prefix.pImpl->data.get(), prefix.pImpl->size) == 0;
+    if (prefix.byteSize() > byteSize()) return false;
+    return Memory::compare(bytes(), prefix.bytes(), prefix.byteSize()) == 0;
 }
 
 Boolean String::endsWith(const String& suffix) const {
     checkValidState();
+    suffix.checkValidState();
 
-    if (suffix.pImpl->size > pImpl->size) return false;
-    return Memory::compare(pImpl->data.get() + (pImpl->size - suffix.pImpl->size), suffix.pImpl->data.get(), suffix.pImpl->size) == 0;
+    if (suffix.byteSize() > byteSize()) return false;
+    return Memory::compare(bytes() + (byteSize() - suffix.byteSize()), suffix.bytes(), suffix.byteSize()) == 0;
 }
 
-List<String> String::split(const String& delimiter) const {
-    checkValidState();
-
-    List<String> result;
-    Size delimiterLength = delimiter.pImpl->size;
-    if (delimiterLength == 0) {
-        result.append(String(reinterpret_cast<CString>(pImpl->data.get()), pImpl->size));
-        return result;
-    }
-
-    const Byte* start = pImpl->data.get();
-    const Byte* end = pImpl->data.get() + pImpl->size;
-    const Byte* current = start;
-
-    while (current < end) {
-        const Byte* found = nullptr;
-        for (Size i = 0; i <= (end - current - delimiterLength); ++i) {
-            if (Memory::compare((Pointer) reinterpret_cast<CString>(current + i),
-                                (Pointer) reinterpret_cast<CString>(delimiter.pImpl->data.get()), delimiterLength) == 0) {
-                found = current + i;
-                break;
-            }
+// Compares two UTF-8 buffers rune by rune after simple case folding, without allocating.
+static Int32 compareFolded(const Byte* a, Size aSize, const Byte* b, Size bSize) {
+    Size i = 0;
+    Size j = 0;
+    while (true) {
+        Size common = AsciiCase::equalPrefix(a + i, b + j, aSize - i < bSize - j ? aSize - i : bSize - j);
+        i += common;
+        j += common;
+        if (i == aSize || j == bSize) {
+            return (i == aSize ? 0 : 1) - (j == bSize ? 0 : 1);
         }
 
-        if (found) {
-            Size segmentSize = found - current;
-            result.append(String(reinterpret_cast<CString>(current), segmentSize));
-            current = found + delimiterLength;
-        } else {
-            result.append(String(reinterpret_cast<CString>(current), end - current));
-            break;
+        Rune left = Unicode::caseFold(Unicode::extractRuneAt(a, i));
+        Rune right = Unicode::caseFold(Unicode::extractRuneAt(b, j));
+        if (left != right) {
+            return left < right ? -1 : 1;
         }
+        i += Unicode::calculateRuneLength(a[i]);
+        j += Unicode::calculateRuneLength(b[j]);
     }
+}
+
+Boolean String::equalsIgnoreCase(const String& other) const {
+    checkValidState();
+    other.checkValidState();
+
+    // Folding maps each rune to exactly one rune, so differing lengths can never compare equal.
+    if (length() != other.length()) return false;
+    return compareFolded(bytes(), byteSize(), other.bytes(), other.byteSize()) == 0;
+}
+
+Int32 String::compareIgnoreCase(const String& other) const {
+    checkValidState();
+    other.checkValidState();
+
+    return compareFolded(bytes(), byteSize(), other.bytes(), other.byteSize());
+}
 
+List<String> String::split(const String& delimiter) const {
+    checkValidState();
+    delimiter.checkValidState();
+
+    List<String> result;
+    for (StringView part : StringView(*this).split(delimiter)) {
+        result.append(part.toString());
+    }
     return result;
 }
 
@@ -293,80 +464,57 @@ List<String> String::getLines() const {
 
 SSize String::find(const String& substring, SSize startIndex) const {
     checkValidState();
+    substring.checkValidState();
 
-    List<Rune> runes;
-    for (Size i = 0; i < pImpl->size; ) {
-        Rune rune = Unicode::extractRuneAt(pImpl->data.get(), i);
-        runes.append(rune);
-        i += Unicode::calculateRuneLength(pImpl->data[i]);
-    }
-
-    List<Rune> subRunes;
-    for (Size i = 0; i < substring.pImpl->size; ) {
-        Rune rune = Unicode::extractRuneAt(substring.pImpl->data.get(), i);
-        subRunes.append(rune);
-        i += Unicode::calculateRuneLength(substring.pImpl->data[i]);
-    }
-
-    Size thisSize = runes.size();
-    Size subSize = subRunes.size();
+    const Byte* data = bytes();
+    Size size = byteSize();
+    auto thisSize = static_cast<SSize>(length());
+    auto subSize = static_cast<SSize>(substring.length());
 
     if (subSize > thisSize) return NPos;
 
     if (startIndex < 0) {
         startIndex = thisSize + startIndex;
-        for (Size i = startIndex; i >= 0; --i) {
-            Boolean found = true;
-            for (Size j = 0; j < subSize; ++j) {
-                if (i + j >= thisSize || runes[i + j] != subRunes[j]) {
-                    found = false;
-                    break;
-                }
-            }
-            if (found) return i;
-        }
-    } else {
-        if (startIndex > thisSize - subSize) {
-            return NPos;
-        }
+        if (startIndex < 0) return NPos;
 
-        for (Size i = startIndex; i <= thisSize - subSize; ++i) {
-            Boolean found = true;
-            for (Size j = 0; j < subSize; ++j) {
-                if (runes[i + j] != subRunes[j]) {
-                    found = false;
-                    break;
-                }
-            }
-            if (found) return i;
-        }
+        // Only occurrences starting at or before startIndex count, so the window ends one needle past it.
+        Size limit = byteOffsetOf(startIndex) + substring.byteSize();
+        const Byte* found = StringSearch::findLast(data, limit < size ? limit : size, substring.bytes(), substring.byteSize());
+        if (!found) return NPos;
+        return static_cast<SSize>(size == length() ? found - data : Utf8::countRunes(data, found - data));
     }
 
-    return NPos;
+    if (startIndex > thisSize - subSize) {
+        return NPos;
+    }
+
+    Size from = byteOffsetOf(startIndex);
+    const Byte* found = StringSearch::findFirst(data + from, size - from, substring.bytes(), substring.byteSize());
+    if (!found) return NPos;
+    return startIndex + static_cast<SSize>(size == length() ? found - (data + from) : Utf8::countRunes(data + from, found - (data + from)));
 }
 
 String& String::operator=(const String& other) {
     if (this != &other) {
-        Byte* srcData = other.pImpl->data.get();
-        Size srcSize = other.pImpl->size;
-
-        if (srcSize != pImpl->size) {
-            pImpl->data.reset(new Byte[srcSize + 1]);
-            pImpl->size = srcSize;
-        }
-
-        Byte* destData = pImpl->data.get();
-        Memory::copy(destData, srcData, srcSize);
-        destData[srcSize] = '\0';
+        String copy(other);
+        *this = TypeTraits::move(copy);
     }
     return *this;
 }
 
 String& String::operator=(String&& other) noexcept {
     if (this != &other) {
-        delete pImpl;
-        pImpl = other.pImpl;
-        other.pImpl = nullptr;
+        release();
+        if (other.m_storage == Storage::Heap) {
+            pImpl = other.pImpl;
+        } else {
+            Memory::copy(m_inline, other.m_inline, InlineCapacity + 1);
+        }
+        m_inlineSize = other.m_inlineSize;
+        m_inlineRuneCount = other.m_inlineRuneCount;
+        m_storage = other.m_storage;
+
+        other.m_storage = Storage::MovedFrom;
     }
     return *this;
 }
@@ -375,22 +523,29 @@ String String::operator+(const String& other) const {
     checkValidState();
     other.checkValidState();
 
-    Size newSize = pImpl->size + other.pImpl->size;
-    Byte* newData = static_cast<Byte*>(Memory::allocate(newSize + 1));
-
-    Memory::copy(newData, pImpl->data.get(), pImpl->size);
-    Memory::copy(newData + pImpl->size, other.pImpl->data.get(), other.pImpl->size);
-    newData[newSize] = '\0';
-
-    return {reinterpret_cast<CString>(newData), newSize};
+    Size size = byteSize();
+    String result;
+    Byte* data = result.initializeUninitialized(size + other.byteSize(), length() + other.length());
+    Memory::copy(data, bytes(), size);
+    Memory::copy(data + size, other.bytes(), other.byteSize());
+    return result;
 }
 
 Boolean String::operator==(const String& other) const {
     checkValidState();
     other.checkValidState();
 
-    return pImpl->size == other.pImpl->size &&
-           Memory::compare(pImpl->data.get(), other.pImpl->data.get(), pImpl->size) == 0;
+    if (byteSize() != other.byteSize()) return false;
+
+    // Heap strings that have both been hashed, as map keys usually have, differ if their hashes do.
+    if (m_storage == Storage::Heap && other.m_storage == Storage::Heap) {
+        if (pImpl == other.pImpl) return true;
+        Hash hash = pImpl->cachedHash.load(std::memory_order_relaxed);
+        Hash otherHash = other.pImpl->cachedHash.load(std::memory_order_relaxed);
+        if (hash != 0 && otherHash != 0 && hash != otherHash) return false;
+    }
+
+    return Memory::compare(bytes(), other.bytes(), byteSize()) == 0;
 }
 
 Boolean String::operator!=(const String& other) const {
@@ -402,17 +557,33 @@ Boolean String::operator!=(const String& other) const {
 
 Array<Byte> String::toBytes() const {
     checkValidState();
-    return Array<Byte>(pImpl->data.get(), pImpl->size);
+    return Array<Byte>(const_cast<Byte*>(bytes()), byteSize());
 }
 
 CString String::rawString() const {
     checkValidState();
-    return reinterpret_cast<CString>(pImpl->data.get());
+    return reinterpret_cast<CString>(bytes());
 }
 
 Size String::rawLength() const {
     checkValidState();
-    return pImpl->size;
+    return byteSize();
+}
+
+Hash String::hashCode() const {
+    checkValidState();
+
+    if (m_storage == Storage::Inline) {
+        return static_cast<Hash>(Hashing::hashBytes(m_inline, m_inlineSize));
+    }
+
+    // A string that really hashes to zero is simply rehashed on every call.
+    Hash cached = pImpl->cachedHash.load(std::memory_order_relaxed);
+    if (cached == 0) {
+        cached = static_cast<Hash>(Hashing::hashBytes(pImpl->data.get(), pImpl->size));
+        pImpl->cachedHash.store(cached, std::memory_order_relaxed);
+    }
+    return cached;
 }
 
 Array<wchar_t> String::toWCString() const {
@@ -420,17 +591,14 @@ Array<wchar_t> String::toWCString() const {
 
 #ifdef _WIN32
     Size utf16Len = 0;
-    Size length = this->length();
-    for (Size i = 0; i < length; ++i) {
-        Rune rune = this->at(i);
+    for (Rune rune : *this) {
         utf16Len += (rune <= 0xFFFF) ? 1 : 2;
     }
 
     Array<wchar_t> wstr(utf16Len + 1);
 
     Size wstrIndex = 0;
-    for (Size i = 0; i < length; ++i) {
-        Rune rune = this->at(i);
+    for (Rune rune : *this) {
         if (rune <= 0xFFFF) {
             wstr[wstrIndex++] = static_cast<wchar_t>(rune);
         } else {
@@ -446,12 +614,23 @@ Array<wchar_t> String::toWCString() const {
 
     Array<wchar_t> wstr(length + 1);
 
-    for (Size i = 0; i < length; ++i) {
-        Rune rune = this->at(i);
-        wstr[i] = static_cast<wchar_t>(rune);
+    // Runes are decoded in blocks so the vectorised decoder does the bulk of the work.
+    Rune block[256];
+    Size written = 0;
+    while (written < length) {
+        Size count = decodeRunes(block, sizeof(block) / sizeof(Rune), written);
+        for (Size i = 0; i < count; ++i) {
+            wstr[written + i] = static_cast<wchar_t>(block[i]);
+        }
+        written += count;
     }
     wstr[length] = L'\0';
 #endif
 
     return wstr;
 }
+
+template<>
+Hash Cedar::Core::hash<String>(const String& value) {
+    return value.hashCode();
+}
@@ -0,0 +1,148 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Cedar/Core/StringBuilder.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
+#include <Cedar/Core/Text/Unicode.h>
+
+#include "./Text/Utf8.h"
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Text;
+
+StringBuilder::StringBuilder() : m_size(0), m_capacity(0), m_runeCount(0) {}
+
+StringBuilder::StringBuilder(Size initialCapacity) : StringBuilder() {
+    reserve(initialCapacity);
+}
+
+StringBuilder::StringBuilder(StringBuilder&& other) noexcept
+        : m_buffer(TypeTraits::move(other.m_buffer)), m_size(other.m_size), m_capacity(other.m_capacity),
+          m_runeCount(other.m_runeCount) {
+    other.m_size = 0;
+    other.m_capacity = 0;
+    other.m_runeCount = 0;
+}
+
+StringBuilder::~StringBuilder() = default;
+
+StringBuilder& StringBuilder::operator=(StringBuilder&& other) noexcept {
+    if (this != &other) {
+        m_buffer = TypeTraits::move(other.m_buffer);
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        m_runeCount = other.m_runeCount;
+        other.m_size = 0;
+        other.m_capacity = 0;
+        other.m_runeCount = 0;
+    }
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(const String& str) {
+    appendBytes(str.bytes(), str.rawLength(), str.length());
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(CString str) {
+    return append(str, Memory::calcCStringLength(str));
+}
+
+StringBuilder& StringBuilder::append(CString str, Size len) {
+    auto data = reinterpret_cast<const Byte*>(str);
+    Size runeCount = 0;
+    if (!Utf8::validate(data, len, runeCount)) {
+        throw InvalidArgumentException("Malformed UTF-8 sequence");
+    }
+    appendBytes(data, len, runeCount);
+    return *this;
+}
+
+StringBuilder& StringBuilder::append(Rune rune) {
+    Byte* end = grow(4);
+    m_size += Unicode::encodeRune(rune, end);
+    m_runeCount++;
+    return *this;
+}
+
+void StringBuilder::reserve(Size capacity) {
+    if (capacity <= m_capacity) return;
+
+    // One extra byte keeps room for the terminator that String expects.
+    auto* buffer = new Byte[capacity + 1];
+    if (m_size > 0) {
+        Memory::copy(buffer, m_buffer.get(), m_size);
+    }
+    m_buffer.reset(buffer);
+    m_capacity = capacity;
+}
+
+void StringBuilder::clear() {
+    m_size = 0;
+    m_runeCount = 0;
+}
+
+Size StringBuilder::length() const {
+    return m_runeCount;
+}
+
+Size StringBuilder::rawLength() const {
+    return m_size;
+}
+
+Size StringBuilder::capacity() const {
+    return m_capacity;
+}
+
+String StringBuilder::build() {
+    // A builder that was never appended to may have no buffer at all.
+    if (m_size == 0) return {};
+
+    String result;
+    if (m_size <= String::InlineCapacity) {
+        // Short results fit inline, so keep the buffer around for the next round of appends.
+        Memory::copy(result.initializeUninitialized(m_size, m_runeCount), m_buffer.get(), m_size);
+    } else {
+        m_buffer[m_size] = '\0';
+        result.adoptBuffer(m_buffer.release(), m_size, m_runeCount);
+        m_capacity = 0;
+    }
+    clear();
+    return result;
+}
+
+// Makes room for `additional` more bytes and returns the current end of the buffer.
+Byte* StringBuilder::grow(Size additional) {
+    if (m_size + additional > m_capacity) {
+        Size capacity = m_capacity < 16 ? 16 : m_capacity * 2;
+        reserve(capacity < m_size + additional ? m_size + additional : capacity);
+    }
+    return m_buffer.get() + m_size;
+}
+
+void StringBuilder::appendBytes(const Byte* data, Size len, Size runeCount) {
+    if (len == 0) return;
+    Memory::copy(grow(len), data, len);
+    m_size += len;
+    m_runeCount += runeCount;
+}
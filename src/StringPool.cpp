@@ -0,0 +1,205 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Cedar/Core/StringPool.h>
+#include <Cedar/Core/Memory.h>
+#include <Cedar/Core/Container/ConcurrentHashMap.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
+#include <Cedar/Core/Exceptions/InvalidStateException.h>
+#include <Cedar/Core/Exceptions/OutOfRangeException.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+
+#include <atomic>
+
+using namespace Cedar::Core;
+
+namespace {
+    // Arena chunk size. Text longer than a quarter of a chunk gets an allocation of its own.
+    constexpr Size ChunkSize = 64 * 1024;
+
+    // Segment s of the entry table holds SegmentBase << s entries, so segments never move once allocated and
+    // 23 of them cover every 32-bit id.
+    constexpr Size SegmentBase = 1024;
+    constexpr Size SegmentCount = 23;
+
+    constexpr Size MaxSymbols = 0xFFFFFFFFULL;
+
+    struct Chunk {
+        Chunk* next;
+
+        Byte* data() {
+            return reinterpret_cast<Byte*>(this + 1);
+        }
+    };
+
+    Size segmentOf(UInt32 id, Size& offset) {
+        Size block = id / SegmentBase + 1;
+        Size segment = 0;
+        while (block >> (segment + 1)) {
+            ++segment;
+        }
+        offset = id - SegmentBase * ((Size(1) << segment) - 1);
+        return segment;
+    }
+}
+
+struct StringPool::Impl {
+    Container::ConcurrentHashMap<StringView, UInt32> index;     // Interned text to id; keys view the arena
+    std::atomic<StringView*> segments[SegmentCount]{};          // Id to interned text
+    std::atomic<UInt32> count{0};
+    std::atomic<Size> arenaBytes{0};
+
+    Threading::Mutex writeLock;                                 // Serializes interning of new text
+    Chunk* chunks = nullptr;
+    Byte* cursor = nullptr;
+    Size remaining = 0;
+
+    ~Impl() {
+        for (auto& segment : segments) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+        while (chunks) {
+            Chunk* next = chunks->next;
+            Memory::release(chunks);
+            chunks = next;
+        }
+    }
+
+    // Copies text into the arena with a null terminator. Must be called with writeLock held.
+    Byte* store(const Byte* text, Size size) {
+        Size needed = size + 1;
+        Byte* stored;
+        if (needed <= remaining) {
+            stored = cursor;
+            cursor += needed;
+            remaining -= needed;
+        } else {
+            Size capacity = needed > ChunkSize / 4 ? needed : ChunkSize;
+            auto* chunk = static_cast<Chunk*>(Memory::allocate(sizeof(Chunk) + capacity));
+            chunk->next = chunks;
+            chunks = chunk;
+            arenaBytes.fetch_add(capacity, std::memory_order_relaxed);
+
+            stored = chunk->data();
+            if (capacity != needed) {
+                // Oversized text leaves the current chunk open for the small strings that follow.
+                cursor = stored + needed;
+                remaining = capacity - needed;
+            }
+        }
+        Memory::copy(stored, text, size);
+        stored[size] = '\0';
+        return stored;
+    }
+
+    StringView& slot(UInt32 id) const {
+        Size offset;
+        Size segment = segmentOf(id, offset);
+        return segments[segment].load(std::memory_order_acquire)[offset];
+    }
+};
+
+StringPool::StringPool() : pImpl(new Impl()) {
+    intern(StringView());
+}
+
+StringPool::~StringPool() {
+    delete pImpl;
+}
+
+Symbol StringPool::intern(StringView text) {
+    UInt32 id;
+    if (pImpl->index.find(text, id)) {
+        return Symbol(id);
+    }
+
+    Threading::LockGuard<Threading::Mutex> lock(pImpl->writeLock);
+    if (pImpl->index.find(text, id)) {
+        return Symbol(id);
+    }
+
+    Size size = text.rawLength();
+    if (size > MaxSymbols) {
+        throw InvalidArgumentException("Text is too long to be interned.");
+    }
+    id = pImpl->count.load(std::memory_order_relaxed);
+    if (id == MaxSymbols) {
+        throw InvalidStateException("StringPool has run out of symbol ids.");
+    }
+
+    Size offset;
+    Size segment = segmentOf(id, offset);
+    StringView* entries = pImpl->segments[segment].load(std::memory_order_relaxed);
+    if (!entries) {
+        entries = new StringView[SegmentBase << segment];
+        pImpl->segments[segment].store(entries, std::memory_order_release);
+    }
+
+    const Byte* stored = pImpl->store(reinterpret_cast<const Byte*>(text.rawData()), size);
+    entries[offset] = StringView(stored, size, text.length());
+
+    // Publishing through the count and the index makes the entry visible to view() and to lock-free lookups.
+    pImpl->count.store(id + 1, std::memory_order_release);
+    pImpl->index.insert(entries[offset], id);
+    return Symbol(id);
+}
+
+Boolean StringPool::find(StringView text, Symbol& symbol) const {
+    UInt32 id;
+    if (!pImpl->index.find(text, id)) {
+        return false;
+    }
+    symbol = Symbol(id);
+    return true;
+}
+
+StringView StringPool::view(Symbol symbol) const {
+    if (symbol.id() >= pImpl->count.load(std::memory_order_acquire)) {
+        throw OutOfRangeException("Symbol does not belong to this StringPool.");
+    }
+    return pImpl->slot(symbol.id());
+}
+
+String StringPool::toString(Symbol symbol) const {
+    return view(symbol).toString();
+}
+
+Size StringPool::size() const {
+    return pImpl->count.load(std::memory_order_acquire);
+}
+
+Size StringPool::arenaSize() const {
+    return pImpl->arenaBytes.load(std::memory_order_relaxed);
+}
+
+StringPool& StringPool::global() {
+    // Never destroyed, so symbols stay usable from other static destructors.
+    static auto* pool = new StringPool();
+    return *pool;
+}
+
+template<>
+Hash Cedar::Core::hash<Symbol>(const Symbol& value) {
+    return hash<UInt32>(value.id());
+}
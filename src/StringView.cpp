@@ -0,0 +1,205 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Cedar/Core/StringView.h>
+#include <Cedar/Core/Memory.h>
+#include <Cedar/Core/Hashing.h>
+#include <Cedar/Core/Text/Unicode.h>
+
+#include "./Text/StringSearch.h"
+#include "./Text/Utf8.h"
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Text;
+
+static const Byte EmptyText[] = "";
+
+// Advances over one rune, stepping a single byte over malformed input so scans always terminate.
+static Size runeLengthAt(const Byte* data, Size i) {
+    Size length = Unicode::calculateRuneLength(data[i]);
+    return length ? length : 1;
+}
+
+static Boolean isSpaceAt(const Byte* data, Size i) {
+    return Unicode::isSpace(data[i] < 0x80 ? data[i] : Unicode::extractRuneAt(data, i));
+}
+
+StringView::StringView() : m_data(EmptyText), m_size(0), m_runeCount(0) {}
+
+StringView::StringView(CString str) : StringView(str, str ? Memory::calcCStringLength(str) : 0) {}
+
+StringView::StringView(CString str, Size len)
+        : m_data(str ? reinterpret_cast<const Byte*>(str) : EmptyText), m_size(str ? len : 0), m_runeCount(UnknownLength) {}
+
+StringView::StringView(const String& str)
+        : m_data(reinterpret_cast<const Byte*>(str.rawString())), m_size(str.rawLength()), m_runeCount(str.length()) {}
+
+StringView::StringView(const Byte* data, Size size, Size runeCount) : m_data(data), m_size(size), m_runeCount(runeCount) {}
+
+Size StringView::length() const {
+    if (m_runeCount == UnknownLength) {
+        m_runeCount = Utf8::countRunes(m_data, m_size);
+    }
+    return m_runeCount;
+}
+
+Size StringView::rawLength() const {
+    return m_size;
+}
+
+CString StringView::rawData() const {
+    return reinterpret_cast<CString>(m_data);
+}
+
+Boolean StringView::isEmpty() const {
+    return m_size == 0;
+}
+
+Boolean StringView::isAsciiOnly() const {
+    return m_runeCount == m_size;
+}
+
+StringView StringView::slice(Size from, Size to) const {
+    return {m_data + from, to - from, isAsciiOnly() ? to - from : UnknownLength};
+}
+
+StringView StringView::trim() const {
+    return trimStart().trimEnd();
+}
+
+StringView StringView::trimStart() const {
+    Size i = 0;
+    while (i < m_size && isSpaceAt(m_data, i)) {
+        i += runeLengthAt(m_data, i);
+    }
+    return slice(i < m_size ? i : m_size, m_size);
+}
+
+StringView StringView::trimEnd() const {
+    Size i = m_size;
+    while (i > 0) {
+        Size prev = i - 1;
+        while (prev > 0 && (m_data[prev] & 0xC0) == 0x80) prev--; // Move back to the start of the rune
+        if (!isSpaceAt(m_data, prev)) break;
+        i = prev;
+    }
+    return slice(0, i);
+}
+
+StringView StringView::stripPrefix(StringView prefix) const {
+    return startsWith(prefix) ? slice(prefix.m_size, m_size) : *this;
+}
+
+StringView StringView::stripSuffix(StringView suffix) const {
+    return endsWith(suffix) ? slice(0, m_size - suffix.m_size) : *this;
+}
+
+Boolean StringView::contains(StringView substring) const {
+    return StringSearch::findFirst(m_data, m_size, substring.m_data, substring.m_size) != nullptr;
+}
+
+Boolean StringView::startsWith(StringView prefix) const {
+    return prefix.m_size <= m_size && Memory::compare(m_data, prefix.m_data, prefix.m_size) == 0;
+}
+
+Boolean StringView::endsWith(StringView suffix) const {
+    return suffix.m_size <= m_size && Memory::compare(m_data + (m_size - suffix.m_size), suffix.m_data, suffix.m_size) == 0;
+}
+
+Boolean StringView::operator==(StringView other) const {
+    return m_size == other.m_size && Memory::compare(m_data, other.m_data, m_size) == 0;
+}
+
+Boolean StringView::operator!=(StringView other) const {
+    return !(*this == other);
+}
+
+// Views can be built over arbitrary bytes, so the copy is validated like String(CString, Size).
+String StringView::toString() const {
+    String result;
+    result.initialize(m_data, m_size);
+    return result;
+}
+
+StringView::SplitRange StringView::split(StringView delimiter) const {
+    return {*this, delimiter};
+}
+
+StringView::SplitRange StringView::lines() const {
+    return split("\n");
+}
+
+StringView::SplitRange::SplitRange(StringView text, StringView delimiter) : m_text(text), m_delimiter(delimiter) {}
+
+StringView::SplitRange::Iterator StringView::SplitRange::begin() const {
+    return {m_text.m_data, m_text.m_data + m_text.m_size, m_delimiter, m_text.isAsciiOnly()};
+}
+
+StringView::SplitRange::Iterator StringView::SplitRange::end() const {
+    return {nullptr, nullptr, m_delimiter, false};
+}
+
+StringView::SplitRange::Iterator::Iterator(const Byte* current, const Byte* end, StringView delimiter, Boolean asciiOnly)
+        : m_current(current), m_end(end), m_delimiter(delimiter), m_asciiOnly(asciiOnly), m_done(false) {
+    advance();
+}
+
+StringView StringView::SplitRange::Iterator::operator*() const {
+    return m_segment;
+}
+
+StringView::SplitRange::Iterator& StringView::SplitRange::Iterator::operator++() {
+    advance();
+    return *this;
+}
+
+Boolean StringView::SplitRange::Iterator::operator==(const Iterator& other) const {
+    if (m_done || other.m_done) return m_done == other.m_done;
+    return m_segment.m_data == other.m_segment.m_data && m_current == other.m_current;
+}
+
+Boolean StringView::SplitRange::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+// A null cursor marks that the last segment has been produced; like String::split, a trailing
+// delimiter does not produce an empty final segment while an empty delimiter yields the whole text once.
+void StringView::SplitRange::Iterator::advance() {
+    if (m_current == nullptr || (m_current >= m_end && m_delimiter.m_size != 0)) {
+        m_done = true;
+        return;
+    }
+
+    const Byte* found = m_delimiter.m_size == 0
+            ? nullptr
+            : StringSearch::findFirst(m_current, m_end - m_current, m_delimiter.m_data, m_delimiter.m_size);
+    const Byte* segmentEnd = found ? found : m_end;
+    Size size = segmentEnd - m_current;
+    m_segment = StringView(m_current, size, m_asciiOnly ? size : UnknownLength);
+    m_current = found ? found + m_delimiter.m_size : nullptr;
+}
+
+template<>
+Hash Cedar::Core::hash<StringView>(const StringView& value) {
+    return static_cast<Hash>(Hashing::hashBytes(value.rawData(), value.rawLength()));
+}
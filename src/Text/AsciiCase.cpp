@@ -0,0 +1,151 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "./AsciiCase.h"
+#include "./Simd.h"
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Text;
+
+using ConvertFunction = Size (*)(const Byte*, Byte*, Size, Byte);
+using EqualPrefixFunction = Size (*)(const Byte*, const Byte*, Size);
+
+// Each converter flips bit 0x20 on the 26 letters starting at first ('a' for upper-casing, 'A' for lower-casing).
+
+static Size convertScalar(const Byte* src, Byte* dst, Size size, Byte first) {
+    Size i = 0;
+    for (; i < size && src[i] < 0x80; ++i) {
+        Byte c = src[i];
+        dst[i] = static_cast<Byte>(c - first) < 26 ? c ^ 0x20 : c;
+    }
+    return i;
+}
+
+static Byte lowerAscii(Byte c) {
+    return static_cast<Byte>(c - 'A') < 26 ? c | 0x20 : c;
+}
+
+static Size equalPrefixScalar(const Byte* a, const Byte* b, Size size) {
+    Size i = 0;
+    for (; i < size && (a[i] | b[i]) < 0x80 && lowerAscii(a[i]) == lowerAscii(b[i]); ++i) {}
+    return i;
+}
+
+#ifdef CEDAR_SIMD_X86
+// Adding 0x80 - first moves the letter range to [-128, -103], so one signed comparison selects it.
+
+CEDAR_SIMD_TARGET("sse2")
+static Size convertSse2(const Byte* src, Byte* dst, Size size, Byte first) {
+    const __m128i shift = _mm_set1_epi8(static_cast<char>(0x80 - first));
+    const __m128i limit = _mm_set1_epi8(-128 + 26);
+    const __m128i flip = _mm_set1_epi8(0x20);
+    Size i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(input) != 0) break;
+        __m128i letters = _mm_cmplt_epi8(_mm_add_epi8(input, shift), limit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(input, _mm_and_si128(letters, flip)));
+    }
+    return i + convertScalar(src + i, dst + i, size - i, first);
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static Size convertAvx2(const Byte* src, Byte* dst, Size size, Byte first) {
+    const __m256i shift = _mm256_set1_epi8(static_cast<char>(0x80 - first));
+    const __m256i limit = _mm256_set1_epi8(-128 + 26);
+    const __m256i flip = _mm256_set1_epi8(0x20);
+    Size i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (_mm256_movemask_epi8(input) != 0) break;
+        __m256i letters = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(input, shift));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(input, _mm256_and_si256(letters, flip)));
+    }
+    return i + convertScalar(src + i, dst + i, size - i, first);
+}
+
+CEDAR_SIMD_TARGET("sse2")
+static Size equalPrefixSse2(const Byte* a, const Byte* b, Size size) {
+    const __m128i shift = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+    const __m128i limit = _mm_set1_epi8(-128 + 26);
+    const __m128i flip = _mm_set1_epi8(0x20);
+    Size i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        left = _mm_or_si128(left, _mm_and_si128(_mm_cmplt_epi8(_mm_add_epi8(left, shift), limit), flip));
+        right = _mm_or_si128(right, _mm_and_si128(_mm_cmplt_epi8(_mm_add_epi8(right, shift), limit), flip));
+        Int32 ascii = _mm_movemask_epi8(_mm_or_si128(left, right)) == 0;
+        if (!ascii || _mm_movemask_epi8(_mm_cmpeq_epi8(left, right)) != 0xFFFF) break;
+    }
+    return i + equalPrefixScalar(a + i, b + i, size - i);
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static Size equalPrefixAvx2(const Byte* a, const Byte* b, Size size) {
+    const __m256i shift = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+    const __m256i limit = _mm256_set1_epi8(-128 + 26);
+    const __m256i flip = _mm256_set1_epi8(0x20);
+    Size i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        left = _mm256_or_si256(left, _mm256_and_si256(_mm256_cmpgt_epi8(limit, _mm256_add_epi8(left, shift)), flip));
+        right = _mm256_or_si256(right, _mm256_and_si256(_mm256_cmpgt_epi8(limit, _mm256_add_epi8(right, shift)), flip));
+        Int32 ascii = _mm256_movemask_epi8(_mm256_or_si256(left, right)) == 0;
+        if (!ascii || _mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)) != -1) break;
+    }
+    return i + equalPrefixScalar(a + i, b + i, size - i);
+}
+#endif
+
+static ConvertFunction selectConvert() {
+#ifdef CEDAR_SIMD_X86
+    if (Simd::hasAvx2()) return convertAvx2;
+    if (Simd::hasSse2()) return convertSse2;
+#endif
+    return convertScalar;
+}
+
+static EqualPrefixFunction selectEqualPrefix() {
+#ifdef CEDAR_SIMD_X86
+    if (Simd::hasAvx2()) return equalPrefixAvx2;
+    if (Simd::hasSse2()) return equalPrefixSse2;
+#endif
+    return equalPrefixScalar;
+}
+
+Size AsciiCase::toUpper(const Byte* src, Byte* dst, Size size) {
+    static const ConvertFunction convert = selectConvert();
+    return convert(src, dst, size, 'a');
+}
+
+Size AsciiCase::toLower(const Byte* src, Byte* dst, Size size) {
+    static const ConvertFunction convert = selectConvert();
+    return convert(src, dst, size, 'A');
+}
+
+Size AsciiCase::equalPrefix(const Byte* a, const Byte* b, Size size) {
+    static const EqualPrefixFunction equalPrefix = selectEqualPrefix();
+    return equalPrefix(a, b, size);
+}
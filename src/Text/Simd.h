@@ -0,0 +1,53 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Cedar/Core/BasicTypes.h>
+
+// Vector kernels are compiled per function with target attributes and selected at runtime,
+// so the library itself keeps building for the baseline instruction set.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CEDAR_SIMD_X86 1
+#define CEDAR_SIMD_TARGET(features) __attribute__((target(features)))
+#include <immintrin.h>
+#endif
+
+namespace Cedar::Core::Text::Simd {
+#ifdef CEDAR_SIMD_X86
+    inline Boolean hasSse2() {
+        static const Boolean supported = (__builtin_cpu_init(), __builtin_cpu_supports("sse2"));
+        return supported;
+    }
+
+    inline Boolean hasSse41() {
+        static const Boolean supported = (__builtin_cpu_init(), __builtin_cpu_supports("sse4.1"));
+        return supported;
+    }
+
+    inline Boolean hasAvx2() {
+        static const Boolean supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+        return supported;
+    }
+#endif
+}
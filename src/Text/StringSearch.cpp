@@ -0,0 +1,229 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "./StringSearch.h"
+#include "./Simd.h"
+
+#include <Cedar/Core/Memory.h>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Text;
+
+// Needles longer than this skip ahead with Boyer-Moore-Horspool instead of the vector filter.
+static constexpr Size ShortNeedleLimit = 32;
+
+using SearchFunction = const Byte* (*)(const Byte*, Size, const Byte*, Size);
+
+// Both kernels below only ever see needleSize >= 1 and haystackSize >= needleSize.
+
+static Boolean matchesAt(const Byte* candidate, const Byte* needle, Size needleSize) {
+    // The first and last bytes have already been checked by the caller.
+    return needleSize <= 2 || Memory::compare(candidate + 1, needle + 1, needleSize - 2) == 0;
+}
+
+static const Byte* findFirstScalar(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    const Byte first = needle[0];
+    const Byte last = needle[needleSize - 1];
+    for (Size i = 0; i + needleSize <= haystackSize; ++i) {
+        if (haystack[i] == first && haystack[i + needleSize - 1] == last && matchesAt(haystack + i, needle, needleSize)) {
+            return haystack + i;
+        }
+    }
+    return nullptr;
+}
+
+static const Byte* findLastScalar(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    const Byte first = needle[0];
+    const Byte last = needle[needleSize - 1];
+    for (Size i = haystackSize - needleSize + 1; i-- > 0;) {
+        if (haystack[i] == first && haystack[i + needleSize - 1] == last && matchesAt(haystack + i, needle, needleSize)) {
+            return haystack + i;
+        }
+    }
+    return nullptr;
+}
+
+static const Byte* findFirstHorspool(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    Size shift[256];
+    for (Size& s : shift) s = needleSize;
+    for (Size i = 0; i + 1 < needleSize; ++i) {
+        shift[needle[i]] = needleSize - 1 - i;
+    }
+
+    const Byte last = needle[needleSize - 1];
+    for (Size i = 0; i + needleSize <= haystackSize; i += shift[haystack[i + needleSize - 1]]) {
+        if (haystack[i + needleSize - 1] == last && Memory::compare(haystack + i, needle, needleSize - 1) == 0) {
+            return haystack + i;
+        }
+    }
+    return nullptr;
+}
+
+static const Byte* findLastHorspool(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    // Horspool on the mirrored problem: the window is anchored on its first byte and slides towards the front.
+    Size shift[256];
+    for (Size& s : shift) s = needleSize;
+    for (Size i = needleSize - 1; i > 0; --i) {
+        shift[needle[i]] = i;
+    }
+
+    const Byte first = needle[0];
+    Size i = haystackSize - needleSize;
+    while (true) {
+        if (haystack[i] == first && Memory::compare(haystack + i + 1, needle + 1, needleSize - 1) == 0) {
+            return haystack + i;
+        }
+        Size step = shift[haystack[i]];
+        if (step > i) return nullptr;
+        i -= step;
+    }
+}
+
+#ifdef CEDAR_SIMD_X86
+// First/last byte filter: a candidate position survives only if both the needle's first byte and its last byte
+// line up, which rejects almost every position of typical text 16 or 32 at a time.
+
+CEDAR_SIMD_TARGET("sse2")
+static const Byte* findFirstSse2(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    const __m128i first = _mm_set1_epi8(static_cast<char>(needle[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(needle[needleSize - 1]));
+    const Size candidates = haystackSize - needleSize + 1;
+
+    Size i = 0;
+    for (; i + 16 <= candidates; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needleSize - 1));
+        auto mask = static_cast<UInt32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst),
+                                                                        _mm_cmpeq_epi8(last, blockLast))));
+        while (mask != 0) {
+            Size offset = i + __builtin_ctz(mask);
+            if (matchesAt(haystack + offset, needle, needleSize)) return haystack + offset;
+            mask &= mask - 1;
+        }
+    }
+
+    return findFirstScalar(haystack + i, haystackSize - i, needle, needleSize);
+}
+
+CEDAR_SIMD_TARGET("sse2")
+static const Byte* findLastSse2(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    const __m128i first = _mm_set1_epi8(static_cast<char>(needle[0]));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(needle[needleSize - 1]));
+    Size candidates = haystackSize - needleSize + 1;
+
+    for (; candidates >= 16; candidates -= 16) {
+        Size base = candidates - 16;
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + base));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + base + needleSize - 1));
+        auto mask = static_cast<UInt32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst),
+                                                                        _mm_cmpeq_epi8(last, blockLast))));
+        while (mask != 0) {
+            Int32 bit = 31 - __builtin_clz(mask);
+            if (matchesAt(haystack + base + bit, needle, needleSize)) return haystack + base + bit;
+            mask &= ~(1u << bit);
+        }
+    }
+
+    if (candidates == 0) return nullptr;
+    return findLastScalar(haystack, candidates + needleSize - 1, needle, needleSize);
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static const Byte* findFirstAvx2(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(needle[0]));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(needle[needleSize - 1]));
+    const Size candidates = haystackSize - needleSize + 1;
+
+    Size i = 0;
+    for (; i + 32 <= candidates; i += 32) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needleSize - 1));
+        auto mask = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst),
+                                                                              _mm256_cmpeq_epi8(last, blockLast))));
+        while (mask != 0) {
+            Size offset = i + __builtin_ctz(mask);
+            if (matchesAt(haystack + offset, needle, needleSize)) return haystack + offset;
+            mask &= mask - 1;
+        }
+    }
+
+    return findFirstSse2(haystack + i, haystackSize - i, needle, needleSize);
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static const Byte* findLastAvx2(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(needle[0]));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(needle[needleSize - 1]));
+    Size candidates = haystackSize - needleSize + 1;
+
+    for (; candidates >= 32; candidates -= 32) {
+        Size base = candidates - 32;
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + base));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + base + needleSize - 1));
+        auto mask = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst),
+                                                                              _mm256_cmpeq_epi8(last, blockLast))));
+        while (mask != 0) {
+            Int32 bit = 31 - __builtin_clz(mask);
+            if (matchesAt(haystack + base + bit, needle, needleSize)) return haystack + base + bit;
+            mask &= ~(1u << bit);
+        }
+    }
+
+    if (candidates == 0) return nullptr;
+    return findLastSse2(haystack, candidates + needleSize - 1, needle, needleSize);
+}
+#endif
+
+static SearchFunction selectFindFirst() {
+#ifdef CEDAR_SIMD_X86
+    if (Simd::hasAvx2()) return findFirstAvx2;
+    if (Simd::hasSse2()) return findFirstSse2;
+#endif
+    return findFirstScalar;
+}
+
+static SearchFunction selectFindLast() {
+#ifdef CEDAR_SIMD_X86
+    if (Simd::hasAvx2()) return findLastAvx2;
+    if (Simd::hasSse2()) return findLastSse2;
+#endif
+    return findLastScalar;
+}
+
+const Byte* StringSearch::findFirst(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    if (needleSize == 0) return haystack;
+    if (needleSize > haystackSize) return nullptr;
+    if (needleSize > ShortNeedleLimit) return findFirstHorspool(haystack, haystackSize, needle, needleSize);
+
+    static const SearchFunction search = selectFindFirst();
+    return search(haystack, haystackSize, needle, needleSize);
+}
+
+const Byte* StringSearch::findLast(const Byte* haystack, Size haystackSize, const Byte* needle, Size needleSize) {
+    if (needleSize == 0) return haystack + haystackSize;
+    if (needleSize > haystackSize) return nullptr;
+    if (needleSize > ShortNeedleLimit) return findLastHorspool(haystack, haystackSize, needle, needleSize);
+
+    static const SearchFunction search = selectFindLast();
+    return search(haystack, haystackSize, needle, needleSize);
+}
@@ -22,57 +22,98 @@
  */
 
 #include <Cedar/Core/Text/Unicode.h>
+#include <Cedar/Core/Exceptions/OutOfRangeException.h>
 
+#include "./Unicode/GeneralCategoryTable.h"
 #include "./Unicode/UnicodeTables.h"
 
 using namespace Cedar::Core;
 using namespace Cedar::Core::Container;
 using namespace Cedar::Core::Text;
 
-Boolean isInRanges(UInt32 codepoint, const Array<UnicodeRange>& ranges) {
-    for (Size i = 0; i < ranges.size(); ++i) {
-        if (codepoint >= ranges[i].start && codepoint <= ranges[i].end) {
-            return true;
-        }
+static UInt8 latin1Flags(Rune codepoint) {
+    return GeneralCategoryTable::Latin1Flags[codepoint];
+}
+
+GeneralCategory Unicode::generalCategory(Rune codepoint) {
+    if (codepoint > 0x10FFFF) {
+        return GeneralCategory::Cn;
     }
-    return false;
+
+    Size block = GeneralCategoryTable::Stage1[codepoint >> GeneralCategoryTable::Shift];
+    Size offset = (block << GeneralCategoryTable::Shift) | (codepoint & GeneralCategoryTable::BlockMask);
+    return static_cast<GeneralCategory>(GeneralCategoryTable::Stage2[offset]);
 }
 
 Boolean Unicode::isLetter(Rune codepoint) {
-    return isInRanges(codepoint, LuRanges) ||
-            isInRanges(codepoint, LlRanges) ||
-            isInRanges(codepoint, LtRanges) ||
-            isInRanges(codepoint, LmRanges) ||
-            isInRanges(codepoint, LoRanges);
+    if (codepoint < 0x100) {
+        return latin1Flags(codepoint) & GeneralCategoryTable::LetterFlag;
+    }
+
+    GeneralCategory category = generalCategory(codepoint);
+    return category >= GeneralCategory::Lu && category <= GeneralCategory::Lo;
 }
 
 Boolean Unicode::isDigit(Rune codepoint) {
-    return isInRanges(codepoint, NdRanges);
+    if (codepoint < 0x100) {
+        return latin1Flags(codepoint) & GeneralCategoryTable::DigitFlag;
+    }
+
+    return generalCategory(codepoint) == GeneralCategory::Nd;
 }
 
 Boolean Unicode::isSpace(Rune codepoint) {
-    return isInRanges(codepoint, ZsRanges) ||
-           isInRanges(codepoint, ZlRanges) ||
-           isInRanges(codepoint, ZpRanges) ||
-           isInRanges(codepoint, CcRanges);
+    if (codepoint < 0x100) {
+        return latin1Flags(codepoint) & GeneralCategoryTable::SpaceFlag;
+    }
+
+    GeneralCategory category = generalCategory(codepoint);
+    return (category >= GeneralCategory::Zs && category <= GeneralCategory::Zp) || category == GeneralCategory::Cc;
+}
+
+static Rune mapCase(const CaseMapping* mappings, Size size, Rune codepoint) {
+    Size low = 0;
+    Size high = size;
+    while (low < high) {
+        Size mid = low + (high - low) / 2;
+        if (mappings[mid].from < codepoint) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return (low < size && mappings[low].from == codepoint) ? mappings[low].to : codepoint;
 }
 
 Rune Unicode::toUpperCase(Rune codepoint) {
     if (codepoint >= 'a' && codepoint <= 'z') {
         return codepoint - ('a' - 'A');
     }
+    if (codepoint < 0x80) {
+        return codepoint;
+    }
 
-    auto* result = ToUpperMap.find(codepoint);
-    return result ? *result : codepoint;
+    return mapCase(ToUpperMap, ToUpperMapSize, codepoint);
 }
 
 Rune Unicode::toLowerCase(Rune codepoint) {
     if (codepoint >= 'A' && codepoint <= 'Z') {
         return codepoint + ('a' - 'A');
     }
+    if (codepoint < 0x80) {
+        return codepoint;
+    }
+
+    return mapCase(ToLowerMap, ToLowerMapSize, codepoint);
+}
+
+// Simple case folding: upper-casing first sends variants such as U+017F (long s) and U+03C2 (final sigma) to one form.
+Rune Unicode::caseFold(Rune codepoint) {
+    if (codepoint < 0x80) {
+        return toLowerCase(codepoint);
+    }
 
-    auto* result = ToLowerMap.find(codepoint);
-    return result ? *result : codepoint;
+    return toLowerCase(toUpperCase(codepoint));
 }
 
 Size Unicode::calculateRuneLength(Byte firstByte) {
@@ -107,25 +148,35 @@ Rune Unicode::extractRuneAt(const Byte *data, Size i) {
     return rune;
 }
 
-String Unicode::encodeRuneToString(Rune codepoint) {
-    Byte buffer[5] = {0};
-
+// Writes the UTF-8 encoding of codepoint to buffer, which must have room for 4 bytes, and returns its length.
+Size Unicode::encodeRune(Rune codepoint, Byte *buffer) {
     if (codepoint < 0x80) {
         buffer[0] = codepoint;
+        return 1;
     } else if (codepoint < 0x800) {
         buffer[0] = 0xC0 | (codepoint >> 6);
         buffer[1] = 0x80 | (codepoint & 0x3F);
+        return 2;
     } else if (codepoint < 0x10000) {
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF) {
+            throw OutOfRangeException("Surrogate code points cannot be encoded as UTF-8");
+        }
         buffer[0] = 0xE0 | (codepoint >> 12);
         buffer[1] = 0x80 | ((codepoint >> 6) & 0x3F);
         buffer[2] = 0x80 | (codepoint & 0x3F);
+        return 3;
     } else if (codepoint <= 0x10FFFF) {
         buffer[0] = 0xF0 | (codepoint >> 18);
         buffer[1] = 0x80 | ((codepoint >> 12) & 0x3F);
         buffer[2] = 0x80 | ((codepoint >> 6) & 0x3F);
         buffer[3] = 0x80 | (codepoint & 0x3F);
-    } else {
-        throw OutOfRangeException("Rune is outside the valid Unicode range");
+        return 4;
     }
-    return (CString)buffer;
+    throw OutOfRangeException("Rune is outside the valid Unicode range");
+}
+
+String Unicode::encodeRuneToString(Rune codepoint) {
+    Byte buffer[4];
+    Size length = encodeRune(codepoint, buffer);
+    return {reinterpret_cast<CString>(buffer), length};
 }
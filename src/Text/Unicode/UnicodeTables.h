@@ -23,48 +23,17 @@
 
 #pragma once
 
-#include <Cedar/Core/Container/Array.h>
-#include <Cedar/Core/Container/HashMap.h>
+#include <Cedar/Core/BasicTypes.h>
 
+// All tables are constant-initialised, so they live in read-only data and are usable before main.
 namespace Cedar::Core::Text {
-    using Core::Container::Array;
-    using Core::Container::HashMap;
-
-    struct UnicodeRange {
-        UInt32 start;
-        UInt32 end;
+    struct CaseMapping {
+        Rune from;
+        Rune to;
     };
 
-    extern const Array<UnicodeRange> CcRanges;
-    extern const Array<UnicodeRange> ZsRanges;
-    extern const Array<UnicodeRange> PoRanges;
-    extern const Array<UnicodeRange> ScRanges;
-    extern const Array<UnicodeRange> PsRanges;
-    extern const Array<UnicodeRange> PeRanges;
-    extern const Array<UnicodeRange> SmRanges;
-    extern const Array<UnicodeRange> PdRanges;
-    extern const Array<UnicodeRange> NdRanges;
-    extern const Array<UnicodeRange> LuRanges;
-    extern const Array<UnicodeRange> SkRanges;
-    extern const Array<UnicodeRange> PcRanges;
-    extern const Array<UnicodeRange> LlRanges;
-    extern const Array<UnicodeRange> SoRanges;
-    extern const Array<UnicodeRange> LoRanges;
-    extern const Array<UnicodeRange> PiRanges;
-    extern const Array<UnicodeRange> CfRanges;
-    extern const Array<UnicodeRange> NoRanges;
-    extern const Array<UnicodeRange> PfRanges;
-    extern const Array<UnicodeRange> LtRanges;
-    extern const Array<UnicodeRange> LmRanges;
-    extern const Array<UnicodeRange> MnRanges;
-    extern const Array<UnicodeRange> MeRanges;
-    extern const Array<UnicodeRange> McRanges;
-    extern const Array<UnicodeRange> NlRanges;
-    extern const Array<UnicodeRange> ZlRanges;
-    extern const Array<UnicodeRange> ZpRanges;
-    extern const Array<UnicodeRange> CsRanges;
-    extern const Array<UnicodeRange> CoRanges;
-
-    extern const HashMap<Rune, Rune> ToUpperMap;
-    extern const HashMap<Rune, Rune> ToLowerMap;
+    extern const CaseMapping ToUpperMap[];
+    extern const Size ToUpperMapSize;
+    extern const CaseMapping ToLowerMap[];
+    extern const Size ToLowerMapSize;
 }
@@ -0,0 +1,397 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "./Utf8.h"
+#include "./Simd.h"
+
+#include <Cedar/Core/Memory.h>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Text;
+
+using ValidateFunction = Boolean (*)(const Byte*, Size, Size&);
+using DecodeFunction = Size (*)(const Byte*, Size, Rune*, Size, Size&);
+
+static Boolean isContinuation(Byte b) {
+    return (b & 0xC0) == 0x80;
+}
+
+static Boolean validateScalar(const Byte* data, Size size, Size& runeCount) {
+    Size count = 0;
+    Size i = 0;
+    while (i < size) {
+        // Skip ASCII eight bytes at a time.
+        if (i + 8 <= size) {
+            UInt64 word;
+            Memory::copy(&word, data + i, 8);
+            if ((word & 0x8080808080808080ULL) == 0) {
+                i += 8;
+                count += 8;
+                continue;
+            }
+        }
+
+        Byte lead = data[i];
+        if (lead < 0x80) {
+            i += 1;
+        } else if (lead >= 0xC2 && lead <= 0xDF) {
+            if (i + 1 >= size || !isContinuation(data[i + 1])) return false;
+            i += 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            if (i + 2 >= size || !isContinuation(data[i + 1]) || !isContinuation(data[i + 2])) return false;
+            if (lead == 0xE0 && data[i + 1] < 0xA0) return false;  // Overlong
+            if (lead == 0xED && data[i + 1] >= 0xA0) return false; // Surrogate
+            i += 3;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            if (i + 3 >= size || !isContinuation(data[i + 1]) || !isContinuation(data[i + 2]) ||
+                !isContinuation(data[i + 3])) return false;
+            if (lead == 0xF0 && data[i + 1] < 0x90) return false;  // Overlong
+            if (lead == 0xF4 && data[i + 1] >= 0x90) return false; // Above U+10FFFF
+            i += 4;
+        } else {
+            return false;
+        }
+        ++count;
+    }
+    runeCount = count;
+    return true;
+}
+
+// Decodes one rune from valid UTF-8 at data[i] and advances i past it.
+static Rune decodeRune(const Byte* data, Size& i) {
+    Byte lead = data[i];
+    if (lead < 0x80) {
+        ++i;
+        return lead;
+    }
+    UInt32 extra = 1 + (lead >= 0xE0) + (lead >= 0xF0);
+    Rune rune = lead & (0x3F >> extra);
+    for (UInt32 k = 1; k <= extra; ++k) {
+        rune = (rune << 6) | (data[i + k] & 0x3F);
+    }
+    i += extra + 1;
+    return rune;
+}
+
+static Size decodeScalar(const Byte* data, Size size, Rune* out, Size max, Size& consumed) {
+    Size i = 0;
+    Size written = 0;
+    while (i < size && written < max) {
+        out[written++] = decodeRune(data, i);
+    }
+    consumed = i;
+    return written;
+}
+
+#ifdef CEDAR_SIMD_X86
+// ASCII runs are widened 16 bytes at a time; anything else falls back to decoding one rune.
+
+CEDAR_SIMD_TARGET("sse2")
+static Size decodeSse2(const Byte* data, Size size, Rune* out, Size max, Size& consumed) {
+    const __m128i zero = _mm_setzero_si128();
+    Size i = 0;
+    Size written = 0;
+    while (i < size && written < max) {
+        if (i + 16 <= size && written + 16 <= max) {
+            __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            if (_mm_movemask_epi8(input) == 0) {
+                __m128i low = _mm_unpacklo_epi8(input, zero);
+                __m128i high = _mm_unpackhi_epi8(input, zero);
+                auto* target = reinterpret_cast<__m128i*>(out + written);
+                _mm_storeu_si128(target, _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(target + 1, _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(target + 2, _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(target + 3, _mm_unpackhi_epi16(high, zero));
+                i += 16;
+                written += 16;
+                continue;
+            }
+        }
+        out[written++] = decodeRune(data, i);
+    }
+    consumed = i;
+    return written;
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static Size decodeAvx2(const Byte* data, Size size, Rune* out, Size max, Size& consumed) {
+    Size i = 0;
+    Size written = 0;
+    while (i < size && written < max) {
+        if (i + 32 <= size && written + 32 <= max) {
+            __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            if (_mm256_movemask_epi8(input) == 0) {
+                auto* target = reinterpret_cast<__m256i*>(out + written);
+                for (Int32 part = 0; part < 4; ++part) {
+                    __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i + part * 8));
+                    _mm256_storeu_si256(target + part, _mm256_cvtepu8_epi32(bytes));
+                }
+                i += 32;
+                written += 32;
+                continue;
+            }
+        }
+        out[written++] = decodeRune(data, i);
+    }
+    consumed = i;
+    return written;
+}
+
+// Vector validation follows Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte".
+// Every byte is classified together with the byte before it through three 16-entry lookups; a pair is
+// invalid when the lookups share a bit, except where a third or fourth continuation byte is expected.
+
+static constexpr Byte TooShort = 1 << 0;     // 11______ 0_______ or 11______ 11______
+static constexpr Byte TooLong = 1 << 1;      // 0_______ 10______
+static constexpr Byte Overlong3 = 1 << 2;    // 11100000 100_____
+static constexpr Byte TooLarge = 1 << 3;     // 11110100 1001____ and above
+static constexpr Byte Surrogate = 1 << 4;    // 11101101 101_____
+static constexpr Byte Overlong2 = 1 << 5;    // 1100000_ 10______
+static constexpr Byte TooLarge1000 = 1 << 6; // 11110101 1000____ and above
+static constexpr Byte Overlong4 = 1 << 6;    // 11110000 1000____
+static constexpr Byte TwoConts = 1 << 7;     // 10______ 10______
+static constexpr Byte Carry = TooShort | TooLong | TwoConts;
+
+#define CEDAR_UTF8_BYTE_1_HIGH \
+    TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, \
+    TwoConts, TwoConts, TwoConts, TwoConts, \
+    TooShort | Overlong2, \
+    TooShort, \
+    TooShort | Overlong3 | Surrogate, \
+    TooShort | TooLarge | TooLarge1000 | Overlong4
+
+#define CEDAR_UTF8_BYTE_1_LOW \
+    Carry | Overlong3 | Overlong2 | Overlong4, \
+    Carry | Overlong2, \
+    Carry, \
+    Carry, \
+    Carry | TooLarge, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000 | Surrogate, \
+    Carry | TooLarge | TooLarge1000, \
+    Carry | TooLarge | TooLarge1000
+
+#define CEDAR_UTF8_BYTE_2_HIGH \
+    TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, \
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4, \
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge, \
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge, \
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge, \
+    TooShort, TooShort, TooShort, TooShort
+
+CEDAR_SIMD_TARGET("sse4.1")
+static __m128i checkBlockSse41(__m128i input, __m128i previous) {
+    const __m128i lowNibble = _mm_set1_epi8(0x0F);
+    const __m128i byte1HighTable = _mm_setr_epi8(CEDAR_UTF8_BYTE_1_HIGH);
+    const __m128i byte1LowTable = _mm_setr_epi8(CEDAR_UTF8_BYTE_1_LOW);
+    const __m128i byte2HighTable = _mm_setr_epi8(CEDAR_UTF8_BYTE_2_HIGH);
+
+    __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    __m128i byte1High = _mm_shuffle_epi8(byte1HighTable, _mm_and_si128(_mm_srli_epi16(prev1, 4), lowNibble));
+    __m128i byte1Low = _mm_shuffle_epi8(byte1LowTable, _mm_and_si128(prev1, lowNibble));
+    __m128i byte2High = _mm_shuffle_epi8(byte2HighTable, _mm_and_si128(_mm_srli_epi16(input, 4), lowNibble));
+    __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+    __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+    __m128i thirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m128i fourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m128i mustContinue = _mm_and_si128(_mm_or_si128(thirdByte, fourthByte), _mm_set1_epi8(static_cast<char>(0x80)));
+    return _mm_xor_si128(mustContinue, special);
+}
+
+CEDAR_SIMD_TARGET("sse4.1")
+static Boolean validateSse41(const Byte* data, Size size, Size& runeCount) {
+    // A block ends in an unfinished sequence when one of its last three bytes starts a longer one.
+    const __m128i incompleteLimit = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                  static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+                                                  static_cast<char>(0xC0 - 1));
+    const __m128i continuationLimit = _mm_set1_epi8(-65); // Bytes above 0xBF as signed values start a rune
+
+    __m128i error = _mm_setzero_si128();
+    __m128i previous = _mm_setzero_si128();
+    __m128i incomplete = _mm_setzero_si128();
+    Size count = 0;
+
+    Size i = 0;
+    Byte tail[16];
+    while (i < size) {
+        __m128i input;
+        Size padding = 0;
+        if (i + 16 <= size) {
+            input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        } else {
+            padding = 16 - (size - i);
+            Memory::copy(tail, data + i, size - i);
+            for (Size k = size - i; k < 16; ++k) tail[k] = 0;
+            input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tail));
+        }
+
+        if (_mm_movemask_epi8(input) == 0) {
+            error = _mm_or_si128(error, incomplete);
+            incomplete = _mm_setzero_si128();
+            count += 16;
+        } else {
+            error = _mm_or_si128(error, checkBlockSse41(input, previous));
+            incomplete = _mm_subs_epu8(input, incompleteLimit);
+            count += __builtin_popcount(static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, continuationLimit))));
+        }
+        count -= padding;
+        previous = input;
+        i += 16;
+    }
+    error = _mm_or_si128(error, incomplete);
+
+    if (!_mm_testz_si128(error, error)) return false;
+    runeCount = count;
+    return true;
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static __m256i previousBytesAvx2(__m256i input, __m256i previous, Int32 distance) {
+    // Bytes shifted in from the previous block; _mm256_alignr_epi8 only works within 128-bit lanes.
+    __m256i carried = _mm256_permute2x128_si256(previous, input, 0x21);
+    switch (distance) {
+        case 1: return _mm256_alignr_epi8(input, carried, 15);
+        case 2: return _mm256_alignr_epi8(input, carried, 14);
+        default: return _mm256_alignr_epi8(input, carried, 13);
+    }
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static __m256i checkBlockAvx2(__m256i input, __m256i previous) {
+    const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+    const __m256i byte1HighTable = _mm256_setr_epi8(CEDAR_UTF8_BYTE_1_HIGH, CEDAR_UTF8_BYTE_1_HIGH);
+    const __m256i byte1LowTable = _mm256_setr_epi8(CEDAR_UTF8_BYTE_1_LOW, CEDAR_UTF8_BYTE_1_LOW);
+    const __m256i byte2HighTable = _mm256_setr_epi8(CEDAR_UTF8_BYTE_2_HIGH, CEDAR_UTF8_BYTE_2_HIGH);
+
+    __m256i prev1 = previousBytesAvx2(input, previous, 1);
+    __m256i byte1High = _mm256_shuffle_epi8(byte1HighTable, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibble));
+    __m256i byte1Low = _mm256_shuffle_epi8(byte1LowTable, _mm256_and_si256(prev1, lowNibble));
+    __m256i byte2High = _mm256_shuffle_epi8(byte2HighTable, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibble));
+    __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+    __m256i prev2 = previousBytesAvx2(input, previous, 2);
+    __m256i prev3 = previousBytesAvx2(input, previous, 3);
+    __m256i thirdByte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m256i fourthByte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m256i mustContinue = _mm256_and_si256(_mm256_or_si256(thirdByte, fourthByte), _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(mustContinue, special);
+}
+
+CEDAR_SIMD_TARGET("avx2")
+static Boolean validateAvx2(const Byte* data, Size size, Size& runeCount) {
+    const __m256i incompleteLimit = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                     static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+                                                     static_cast<char>(0xC0 - 1));
+    const __m256i continuationLimit = _mm256_set1_epi8(-65);
+
+    __m256i error = _mm256_setzero_si256();
+    __m256i previous = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+    Size count = 0;
+
+    Size i = 0;
+    Byte tail[32];
+    while (i < size) {
+        __m256i input;
+        Size padding = 0;
+        if (i + 32 <= size) {
+            input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        } else {
+            padding = 32 - (size - i);
+            Memory::copy(tail, data + i, size - i);
+            for (Size k = size - i; k < 32; ++k) tail[k] = 0;
+            input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail));
+        }
+
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = _mm256_or_si256(error, incomplete);
+            incomplete = _mm256_setzero_si256();
+            count += 32;
+        } else {
+            error = _mm256_or_si256(error, checkBlockAvx2(input, previous));
+            incomplete = _mm256_subs_epu8(input, incompleteLimit);
+            count += __builtin_popcount(static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, continuationLimit))));
+        }
+        count -= padding;
+        previous = input;
+        i += 32;
+    }
+    error = _mm256_or_si256(error, incomplete);
+
+    if (!_mm256_testz_si256(error, error)) return false;
+    runeCount = count;
+    return true;
+}
+
+#undef CEDAR_UTF8_BYTE_1_HIGH
+#undef CEDAR_UTF8_BYTE_1_LOW
+#undef CEDAR_UTF8_BYTE_2_HIGH
+#endif
+
+static ValidateFunction selectValidate() {
+#ifdef CEDAR_SIMD_X86
+    if (Simd::hasAvx2()) return validateAvx2;
+    if (Simd::hasSse41()) return validateSse41;
+#endif
+    return validateScalar;
+}
+
+static DecodeFunction selectDecode() {
+#ifdef CEDAR_SIMD_X86
+    if (Simd::hasAvx2()) return decodeAvx2;
+    if (Simd::hasSse2()) return decodeSse2;
+#endif
+    return decodeScalar;
+}
+
+Boolean Utf8::validate(const Byte* data, Size size, Size& runeCount) {
+    // Inline-sized strings are done before the vector setup would pay off.
+    if (size < 32) {
+        return validateScalar(data, size, runeCount);
+    }
+    static const ValidateFunction validate = selectValidate();
+    return validate(data, size, runeCount);
+}
+
+Size Utf8::countRunes(const Byte* data, Size size) {
+    Size runeCount = 0;
+    for (Size i = 0; i < size; ++i) {
+        runeCount += !isContinuation(data[i]);
+    }
+    return runeCount;
+}
+
+Size Utf8::decode(const Byte* data, Size size, Rune* out, Size max, Size& consumed) {
+    static const DecodeFunction decode = selectDecode();
+    return decode(data, size, out, max, consumed);
+}
@@ -0,0 +1,194 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <Cedar/Core/Threading/Epoch.h>
+#include <Cedar/Core/Threading/Mutex.h>
+#include <Cedar/Core/Threading/LockGuard.h>
+
+#include <atomic>
+
+using namespace Cedar::Core;
+using namespace Cedar::Core::Threading;
+
+namespace {
+    // A participant outside any guard publishes this instead of an epoch.
+    constexpr UInt64 Quiescent = 0;
+
+    // A thread scans its retired list once this many entries have accumulated.
+    constexpr Size CollectThreshold = 64;
+
+    struct Retired {
+        Pointer pointer;
+        Epoch::Deleter deleter;
+        UInt64 epoch;
+        Retired* next;
+    };
+
+    // Per-thread state. Participants are never freed; a thread that exits hands its slot to the next new thread.
+    struct alignas(64) Participant {
+        std::atomic<UInt64> epoch{Quiescent};
+        std::atomic<Boolean> active{false};
+        Participant* next = nullptr;
+        UInt32 nesting = 0;
+        Retired* retired = nullptr;     // Newest first, so epochs never increase along the list
+        Size retiredCount = 0;
+        Size collectAt = CollectThreshold;
+    };
+
+    std::atomic<UInt64> globalEpoch{1};
+    std::atomic<Participant*> participants{nullptr};
+
+    // Memory retired by threads that exited before it could be freed. Never destroyed, so exiting threads can use it.
+    struct Orphans {
+        Mutex lock;
+        Retired* list = nullptr;
+    };
+
+    Orphans& orphans() {
+        static auto* instance = new Orphans();
+        return *instance;
+    }
+
+    Participant* acquireParticipant() {
+        for (Participant* p = participants.load(std::memory_order_acquire); p; p = p->next) {
+            Boolean expected = false;
+            if (!p->active.load(std::memory_order_relaxed) &&
+                p->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return p;
+            }
+        }
+
+        auto* participant = new Participant();
+        participant->active.store(true, std::memory_order_relaxed);
+        Participant* head = participants.load(std::memory_order_relaxed);
+        do {
+            participant->next = head;
+        } while (!participants.compare_exchange_weak(head, participant, std::memory_order_release, std::memory_order_relaxed));
+        return participant;
+    }
+
+    // Advances the global epoch if every pinned participant has observed the current one, and returns the epoch.
+    UInt64 tryAdvance() {
+        UInt64 current = globalEpoch.load(std::memory_order_seq_cst);
+        for (Participant* p = participants.load(std::memory_order_acquire); p; p = p->next) {
+            UInt64 pinned = p->epoch.load(std::memory_order_seq_cst);
+            if (pinned != Quiescent && pinned != current) {
+                return current;
+            }
+        }
+        globalEpoch.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);
+        return globalEpoch.load(std::memory_order_seq_cst);
+    }
+
+    // Frees and unlinks every entry of list retired at least two epochs before epoch; returns how many were freed.
+    Size freeExpired(Retired*& list, UInt64 epoch) {
+        Size freed = 0;
+        Retired** link = &list;
+        while (*link) {
+            Retired* entry = *link;
+            if (entry->epoch + 2 <= epoch) {
+                *link = entry->next;
+                entry->deleter(entry->pointer);
+                delete entry;
+                ++freed;
+            } else {
+                link = &entry->next;
+            }
+        }
+        return freed;
+    }
+
+    void collectFor(Participant* participant) {
+        UInt64 epoch = tryAdvance();
+        participant->retiredCount -= freeExpired(participant->retired, epoch);
+
+        // While a stalled reader holds entries back, scan again only after the backlog has doubled.
+        participant->collectAt = participant->retiredCount < CollectThreshold / 2 ? CollectThreshold : participant->retiredCount * 2;
+
+        Orphans& pending = orphans();
+        LockGuard<Mutex> lock(pending.lock);
+        freeExpired(pending.list, epoch);
+    }
+
+    struct LocalParticipant {
+        Participant* participant = nullptr;
+
+        ~LocalParticipant() {
+            if (!participant) return;
+
+            collectFor(participant);
+            if (participant->retired) {
+                Retired* tail = participant->retired;
+                while (tail->next) {
+                    tail = tail->next;
+                }
+                Orphans& pending = orphans();
+                LockGuard<Mutex> lock(pending.lock);
+                tail->next = pending.list;
+                pending.list = participant->retired;
+            }
+            participant->retired = nullptr;
+            participant->retiredCount = 0;
+            participant->collectAt = CollectThreshold;
+            participant->epoch.store(Quiescent, std::memory_order_seq_cst);
+            participant->active.store(false, std::memory_order_release);
+        }
+
+        Participant* get() {
+            if (!participant) {
+                participant = acquireParticipant();
+            }
+            return participant;
+        }
+    };
+
+    thread_local LocalParticipant local;
+}
+
+Epoch::Guard::Guard() {
+    Participant* participant = local.get();
+    if (participant->nesting++ == 0) {
+        // Sequentially consistent, so the pin is visible to tryAdvance() before this thread reads any shared pointer.
+        participant->epoch.store(globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    }
+}
+
+Epoch::Guard::~Guard() {
+    Participant* participant = local.get();
+    if (--participant->nesting == 0) {
+        participant->epoch.store(Quiescent, std::memory_order_release);
+    }
+}
+
+void Epoch::retire(Pointer pointer, Deleter deleter) {
+    Participant* participant = local.get();
+    UInt64 epoch = globalEpoch.load(std::memory_order_seq_cst);
+    participant->retired = new Retired{pointer, deleter, epoch, participant->retired};
+    if (++participant->retiredCount >= participant->collectAt) {
+        collectFor(participant);
+    }
+}
+
+void Epoch::collect() {
+    collectFor(local.get());
+}
@@ -25,6 +25,7 @@
 #include <Cedar/Core/Exceptions/RuntimeException.h>
 
 #include <pthread.h>
+#include <sched.h>
 
 using namespace Cedar::Core;
 using namespace Cedar::Core::Threading;
@@ -95,3 +96,7 @@ void Thread::join() {
 void Thread::detach() {
     pImpl->detach();
 }
+
+void Thread::yield() {
+    sched_yield();
+}
@@ -24,6 +24,10 @@
 #include <gtest/gtest.h>
 #include <Cedar/Core/Exceptions/OutOfRangeException.h>
 #include <Cedar/Core/Container/ArrayList.h>
+#include <Cedar/Core/String.h>
+
+#include <string>
+#include <vector>
 
 namespace Cedar::Core::Container {
     TEST(ArrayListTest, InsertAtAndRemoveAt) {
@@ -62,4 +66,205 @@ namespace Cedar::Core::Container {
 
         EXPECT_THROW({ list[1]; }, OutOfRangeException);
     }
+
+    TEST(ArrayListTest, Iteration) {
+        ArrayList<int> list;
+        for (int i = 0; i < 100; ++i) {
+            list.append(i);
+        }
+
+        int sum = 0;
+        for (int& value : list) {
+            value *= 2;
+        }
+        for (const int& value : static_cast<const ArrayList<int>&>(list)) {
+            sum += value;
+        }
+        EXPECT_EQ(sum, 9900);
+        EXPECT_EQ(list.data()[99], 198);
+    }
+
+    TEST(ArrayListTest, CopyMoveAndClear) {
+        ArrayList<std::string> list;
+        list.append("alpha");
+        list.append("beta");
+
+        ArrayList<std::string> copy = list;
+        copy.append("gamma");
+        EXPECT_EQ(list.size(), 2);
+        EXPECT_EQ(copy.size(), 3);
+        EXPECT_EQ(copy[2], "gamma");
+
+        ArrayList<std::string> moved = static_cast<ArrayList<std::string>&&>(copy);
+        EXPECT_EQ(moved.size(), 3);
+        EXPECT_EQ(moved[0], "alpha");
+
+        list = moved;
+        EXPECT_EQ(list.size(), 3);
+
+        Size capacity = list.capacity();
+        list.clear();
+        EXPECT_TRUE(list.isEmpty());
+        EXPECT_EQ(list.capacity(), capacity);
+        list.append("delta");
+        EXPECT_EQ(list[0], "delta");
+    }
+
+    TEST(ArrayListTest, MoveOnlyElements) {
+        ArrayList<Memory::UniquePointer<int>> list;
+        for (int i = 0; i < 10; ++i) {
+            list.append(Memory::UniquePointer<int>(new int(i)));
+        }
+        list.emplace(new int(10));
+        list.emplaceAt(0, new int(-1));
+        list.insertAt(5, Memory::UniquePointer<int>(new int(100)));
+
+        ASSERT_EQ(list.size(), 13);
+        EXPECT_EQ(*list[0], -1);
+        EXPECT_EQ(*list[1], 0);
+        EXPECT_EQ(*list[5], 100);
+        EXPECT_EQ(*list[6], 4);
+        EXPECT_EQ(*list[12], 10);
+
+        list.removeRange(1, 5);
+        ASSERT_EQ(list.size(), 8);
+        EXPECT_EQ(*list[1], 4);
+        EXPECT_THROW(list.removeRange(5, 4), OutOfRangeException);
+    }
+
+    TEST(ArrayListTest, RelocatesStrings) {
+        static_assert(TypeTraits::IsTriviallyRelocatable<String>::value);
+        static_assert(TypeTraits::IsTriviallyRelocatable<int>::value);
+        static_assert(!TypeTraits::IsTriviallyRelocatable<std::string>::value);
+
+        ArrayList<String> list;
+        for (int i = 0; i < 1000; ++i) {
+            list.append(String(std::to_string(i).c_str()) + " is a number long enough to live on the heap");
+        }
+        list.insertAt(0, list[999]);
+        list.append(list[0]);
+
+        ASSERT_EQ(list.size(), 1002);
+        EXPECT_EQ(list[0], list[1000]);
+        EXPECT_EQ(list[1001], list[0]);
+        EXPECT_EQ(list[1], "0 is a number long enough to live on the heap");
+
+        list.removeRange(0, 500);
+        list.shrinkToFit();
+        EXPECT_EQ(list.capacity(), 502);
+        EXPECT_EQ(list[0], "499 is a number long enough to live on the heap");
+        list.reserve(4096);
+        EXPECT_EQ(list.capacity(), 4096);
+        EXPECT_EQ(list[501], list[500]);
+    }
+
+    TEST(ArrayListTest, InsertRange) {
+        ArrayList<std::string> list;
+        std::string words[] = {"a", "b", "c", "d"};
+        list.insertRange(0, words, 4);
+        list.insertRange(2, words, 2);
+        list.insertRange(list.size(), list.data() + 1, 3);
+
+        const char* expected[] = {"a", "b", "a", "b", "c", "d", "b", "a", "b"};
+        ASSERT_EQ(list.size(), 9);
+        for (Size i = 0; i < list.size(); ++i) {
+            EXPECT_EQ(list[i], expected[i]);
+        }
+        EXPECT_THROW(list.insertRange(10, words, 1), OutOfRangeException);
+    }
+
+    TEST(ArrayListTest, AppendRangeAndAssign) {
+        Int64 numbers[1000];
+        for (int i = 0; i < 1000; ++i) {
+            numbers[i] = i * 3;
+        }
+
+        ArrayList<Int64> list;
+        list.appendRange(numbers, 1000);
+        list.appendRange(numbers + 10, numbers + 20);
+        ASSERT_EQ(list.size(), 1010);
+        EXPECT_EQ(list[999], 2997);
+        EXPECT_EQ(list[1009], 57);
+
+        list.appendRange(list.data(), 10);
+        EXPECT_EQ(list.size(), 1020);
+        EXPECT_EQ(list[1019], 27);
+
+        std::vector<std::string> words = {"x", "y", "z"};
+        ArrayList<std::string> strings;
+        strings.appendRange(words.begin(), words.end());
+        strings.assign(strings.data() + 1, 2);
+        ASSERT_EQ(strings.size(), 2);
+        EXPECT_EQ(strings[0], "y");
+        EXPECT_EQ(strings[1], "z");
+
+        strings.assign(words.begin(), words.end());
+        EXPECT_EQ(strings.size(), 3);
+        strings.assign(4, strings[2]);
+        ASSERT_EQ(strings.size(), 4);
+        EXPECT_EQ(strings[3], "z");
+
+        ArrayList<int> filled;
+        filled.assign(3, 7);
+        ASSERT_EQ(filled.size(), 3);
+        EXPECT_EQ(filled[0], 7);
+        EXPECT_EQ(filled[2], 7);
+        filled.assign(filled.data(), 2);
+        EXPECT_EQ(filled.size(), 2);
+    }
+
+    // Tests pointer and iterator ranges that come from the list itself.
+    TEST(ArrayListTest, RangesFromSelf) {
+        ArrayList<int> numbers;
+        for (int i = 0; i < 10; ++i) {
+            numbers.append(i);
+        }
+        int *first = numbers.data();
+        numbers.appendRange(first + 2, first + 5);
+        ASSERT_EQ(numbers.size(), 13);
+        EXPECT_EQ(numbers[10], 2);
+        EXPECT_EQ(numbers[12], 4);
+
+        const int *constFirst = numbers.data();
+        numbers.assign(constFirst + 10, constFirst + 13);
+        ASSERT_EQ(numbers.size(), 3);
+        EXPECT_EQ(numbers[0], 2);
+        EXPECT_EQ(numbers[2], 4);
+
+        ArrayList<std::string> strings;
+        strings.append("first");
+        strings.append("a string too long for the small-string buffer");
+        strings.assign(strings.begin(), strings.end());
+        ASSERT_EQ(strings.size(), 2);
+        EXPECT_EQ(strings[1], "a string too long for the small-string buffer");
+        strings.appendRange(strings.data(), strings.data() + 2);
+        ASSERT_EQ(strings.size(), 4);
+        EXPECT_EQ(strings[3], "a string too long for the small-string buffer");
+    }
+
+    TEST(ArrayListTest, Resize) {
+        ArrayList<int> list;
+        list.append(7);
+        list.resize(100);
+        ASSERT_EQ(list.size(), 100);
+        EXPECT_EQ(list[0], 7);
+        EXPECT_EQ(list[99], 0);
+
+        list.resize(200, list[0]);
+        EXPECT_EQ(list[199], 7);
+        list.resize(3);
+        EXPECT_EQ(list.size(), 3);
+
+        list.resizeUninitialized(50);
+        EXPECT_EQ(list.size(), 50);
+        EXPECT_EQ(list[0], 7);
+
+        ArrayList<std::string> strings;
+        strings.resize(5, "fill");
+        strings.resize(2);
+        strings.resize(4);
+        ASSERT_EQ(strings.size(), 4);
+        EXPECT_EQ(strings[1], "fill");
+        EXPECT_EQ(strings[3], "");
+    }
 }
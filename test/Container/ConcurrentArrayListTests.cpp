@@ -0,0 +1,88 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/ConcurrentArrayList.h>
+#include <Cedar/Core/Exceptions/OutOfRangeException.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+namespace Cedar::Core::Container {
+    // Tests that the wrapper forwards to ArrayList and reports bad indexes the same way.
+    TEST(ConcurrentArrayListTest, BasicOperations) {
+        ConcurrentArrayList<int> list;
+        list.append(1);
+        list.append(3);
+        list.insertAt(1, 2);
+
+        EXPECT_EQ(list.size(), 3);
+        EXPECT_EQ(list.get(1), 2);
+        list.set(1, 20);
+        EXPECT_EQ(list.get(1), 20);
+        EXPECT_TRUE(list.remove(20));
+        EXPECT_THROW((void) list.get(2), OutOfRangeException);
+
+        int sum = 0;
+        list.forEach([&sum](int value) { sum += value; });
+        EXPECT_EQ(sum, 4);
+
+        int more[] = {5, 6, 7};
+        list.appendRange(more, 3);
+        EXPECT_EQ(list.size(), 5);
+        EXPECT_EQ(list.get(4), 7);
+
+        ArrayList<int> copy = list.snapshot();
+        list.clear();
+        EXPECT_EQ(list.size(), 0);
+        EXPECT_EQ(copy.size(), 5);
+    }
+
+    // Tests that appends from several threads are all kept.
+    TEST(ConcurrentArrayListTest, ConcurrentAppend) {
+        constexpr int Threads = 4;
+        constexpr int PerThread = 10000;
+        ConcurrentArrayList<int> list;
+
+        Threading::Thread* threads[Threads];
+        for (int t = 0; t < Threads; ++t) {
+            Function<void> work = [&list, t]() {
+                for (int i = 0; i < PerThread; ++i) {
+                    list.append(t * PerThread + i);
+                }
+            };
+            threads[t] = new Threading::Thread(work);
+            threads[t]->start();
+        }
+        for (auto* thread : threads) {
+            thread->join();
+            delete thread;
+        }
+
+        ArrayList<int> values = list.snapshot();
+        ASSERT_EQ(values.size(), Threads * PerThread);
+        long long sum = 0;
+        for (int value : values) {
+            sum += value;
+        }
+        EXPECT_EQ(sum, static_cast<long long>(Threads * PerThread) * (Threads * PerThread - 1) / 2);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/ConcurrentHashMap.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <atomic>
+
+namespace Cedar::Core::Container {
+    // Tests single-threaded insert, replace, find and remove.
+    TEST(ConcurrentHashMapTest, BasicOperations) {
+        ConcurrentHashMap<int, int> map;
+        int value = 0;
+
+        EXPECT_TRUE(map.insert(1, 10));
+        EXPECT_TRUE(map.insert(2, 20));
+        EXPECT_FALSE(map.insert(1, 11));
+        EXPECT_EQ(map.size(), 2);
+
+        EXPECT_TRUE(map.find(1, value));
+        EXPECT_EQ(value, 11);
+        EXPECT_FALSE(map.find(3, value));
+
+        EXPECT_TRUE(map.remove(1));
+        EXPECT_FALSE(map.remove(1));
+        EXPECT_FALSE(map.contains(1));
+        EXPECT_TRUE(map.contains(2));
+        EXPECT_EQ(map.size(), 1);
+    }
+
+    // Tests that entries survive several rounds of growth.
+    TEST(ConcurrentHashMapTest, GrowsIncrementally) {
+        ConcurrentHashMap<int, int> map;
+        for (int i = 0; i < 50000; ++i) {
+            map.insert(i, i * 3);
+        }
+
+        EXPECT_EQ(map.size(), 50000);
+        for (int i = 0; i < 50000; ++i) {
+            int value = 0;
+            ASSERT_TRUE(map.find(i, value));
+            EXPECT_EQ(value, i * 3);
+        }
+    }
+
+    // Tests writers on disjoint key ranges racing with readers that check every value they see.
+    TEST(ConcurrentHashMapTest, ConcurrentReadersAndWriters) {
+        constexpr int Writers = 4;
+        constexpr int KeysPerWriter = 20000;
+
+        ConcurrentHashMap<int, int> map;
+        std::atomic<bool> done(false);
+        std::atomic<int> badReads(0);
+
+        Function<void> reader = [&]() {
+            int key = 0;
+            while (!done.load()) {
+                int value = 0;
+                if (map.find(key, value) && value != key * 2) {
+                    badReads.fetch_add(1);
+                }
+                key = (key + 7919) % (Writers * KeysPerWriter);
+            }
+        };
+
+        Threading::Thread readerA(reader);
+        Threading::Thread readerB(reader);
+        readerA.start();
+        readerB.start();
+
+        Threading::Thread* writers[Writers];
+        for (int w = 0; w < Writers; ++w) {
+            Function<void> write = [&map, w]() {
+                for (int i = w * KeysPerWriter; i < (w + 1) * KeysPerWriter; ++i) {
+                    map.insert(i, i * 2);
+                    if (i % 3 == 0) {
+                        map.remove(i);
+                    }
+                }
+            };
+            writers[w] = new Threading::Thread(write);
+            writers[w]->start();
+        }
+        for (auto* writer : writers) {
+            writer->join();
+            delete writer;
+        }
+        done.store(true);
+        readerA.join();
+        readerB.join();
+
+        EXPECT_EQ(badReads.load(), 0);
+        int expected = 0;
+        for (int i = 0; i < Writers * KeysPerWriter; ++i) {
+            expected += i % 3 != 0;
+            EXPECT_EQ(map.contains(i), i % 3 != 0);
+        }
+        EXPECT_EQ(map.size(), expected);
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/ConcurrentStack.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <atomic>
+#include <string>
+
+namespace Cedar::Core::Container {
+    // Tests single-threaded LIFO order and that popped nodes are reused.
+    TEST(ConcurrentStackTest, LifoOrder) {
+        ConcurrentStack<std::string> stack;
+        EXPECT_TRUE(stack.isEmpty());
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 200; ++i) {
+                stack.push(std::to_string(i));
+            }
+            std::string out;
+            for (int i = 199; i >= 0; --i) {
+                ASSERT_TRUE(stack.tryPop(out));
+                EXPECT_EQ(out, std::to_string(i));
+            }
+            EXPECT_FALSE(stack.tryPop(out));
+        }
+        stack.emplace(2, 'x');
+        EXPECT_FALSE(stack.isEmpty());
+    }
+
+    // Tests threads that keep popping buffers and pushing them back: no buffer may be lost or handed out twice.
+    TEST(ConcurrentStackTest, RecyclingAcrossThreads) {
+        constexpr int Threads = 4;
+        constexpr int Buffers = 64;
+        constexpr int Rounds = 20000;
+
+        ConcurrentStack<int> stack;
+        std::atomic<int> owners[Buffers];
+        for (int i = 0; i < Buffers; ++i) {
+            owners[i].store(0);
+            stack.push(i);
+        }
+        std::atomic<int> doubleOwned(0);
+
+        Threading::Thread* threads[Threads];
+        for (int t = 0; t < Threads; ++t) {
+            Function<void> work = [&stack, &owners, &doubleOwned]() {
+                for (int round = 0; round < Rounds; ++round) {
+                    int buffer;
+                    if (!stack.tryPop(buffer)) {
+                        continue;
+                    }
+                    if (owners[buffer].fetch_add(1) != 0) {
+                        doubleOwned.fetch_add(1);
+                    }
+                    owners[buffer].fetch_sub(1);
+                    stack.push(buffer);
+                }
+            };
+            threads[t] = new Threading::Thread(work);
+            threads[t]->start();
+        }
+        for (auto* thread : threads) {
+            thread->join();
+            delete thread;
+        }
+
+        EXPECT_EQ(doubleOwned.load(), 0);
+        int count = 0;
+        long long sum = 0;
+        int buffer;
+        while (stack.tryPop(buffer)) {
+            ++count;
+            sum += buffer;
+        }
+        EXPECT_EQ(count, Buffers);
+        EXPECT_EQ(sum, Buffers * (Buffers - 1) / 2);
+    }
+}
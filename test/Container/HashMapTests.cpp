@@ -23,8 +23,20 @@
 
 #include <gtest/gtest.h>
 #include <Cedar/Core/Container/HashMap.h>
+#include <Cedar/Core/String.h>
 
 namespace Cedar::Core::Container {
+    namespace {
+        String decimal(int value) {
+            String result;
+            do {
+                result = String(static_cast<Rune>('0' + value % 10)) + result;
+                value /= 10;
+            } while (value);
+            return result;
+        }
+    }
+
     TEST(HashMapTest, InsertAndFind) {
         HashMap<int, std::string, 10> map;
 
@@ -60,4 +72,123 @@ namespace Cedar::Core::Container {
         EXPECT_EQ(map.find(1), nullptr);
         EXPECT_EQ(map.find(2), nullptr);
     }
+
+    TEST(HashMapTest, ClearEmpty) {
+        HashMap<Int32, Int32> map;
+
+        map.clear();
+        EXPECT_TRUE(map.isEmpty());
+        map.insert(1, 10);
+        EXPECT_EQ(*map.find(1), 10);
+    }
+
+    TEST(HashMapTest, InsertReplacesExistingValue) {
+        HashMap<int, String> map;
+
+        map.insert(1, "one");
+        map.insert(1, "uno");
+
+        EXPECT_EQ(map.size(), 1);
+        EXPECT_EQ(*map.find(1), "uno");
+    }
+
+    TEST(HashMapTest, GrowsPastInitialCapacity) {
+        HashMap<int, int, 10> map;
+
+        for (int i = 0; i < 100000; ++i) {
+            map.insert(i, i * 2);
+        }
+
+        EXPECT_EQ(map.size(), 100000);
+        for (int i = 0; i < 100000; ++i) {
+            ASSERT_NE(map.find(i), nullptr);
+            EXPECT_EQ(*map.find(i), i * 2);
+        }
+        EXPECT_EQ(map.find(100000), nullptr);
+    }
+
+    TEST(HashMapTest, RemoveAndReinsert) {
+        HashMap<int, int> map;
+
+        for (int round = 0; round < 20; ++round) {
+            for (int i = 0; i < 1000; ++i) {
+                map.insert(i, round);
+            }
+            for (int i = 0; i < 1000; i += 2) {
+                EXPECT_TRUE(map.remove(i));
+            }
+            EXPECT_EQ(map.size(), 500);
+            for (int i = 0; i < 1000; ++i) {
+                EXPECT_EQ(map.find(i) != nullptr, i % 2 == 1);
+            }
+        }
+    }
+
+    TEST(HashMapTest, SubscriptInsertsDefault) {
+        HashMap<int, int> map;
+
+        map[7] += 3;
+        map[7] += 4;
+
+        EXPECT_EQ(map.size(), 1);
+        EXPECT_EQ(map[7], 7);
+        EXPECT_EQ(map[8], 0);
+        EXPECT_EQ(map.size(), 2);
+    }
+
+    TEST(HashMapTest, IterationVisitsEveryEntry) {
+        HashMap<int, int> map = {{1, 10}, {2, 20}, {3, 30}};
+        map.insert(4, 40);
+        map.remove(2);
+
+        int keySum = 0;
+        int valueSum = 0;
+        for (auto entry : map) {
+            keySum += entry.first;
+            valueSum += entry.second;
+            entry.second += 1;
+        }
+
+        EXPECT_EQ(keySum, 8);
+        EXPECT_EQ(valueSum, 80);
+        EXPECT_EQ(*map.find(4), 41);
+    }
+
+    TEST(HashMapTest, CopyAndMove) {
+        HashMap<String, String> map;
+        for (int i = 0; i < 50; ++i) {
+            map.insert(decimal(i), decimal(i * 2));
+        }
+        map.remove("10");
+
+        HashMap<String, String> copy = map;
+        map.insert("10", "twenty");
+
+        EXPECT_EQ(copy.size(), 49);
+        EXPECT_EQ(copy.find("10"), nullptr);
+        EXPECT_EQ(*copy.find("42"), "84");
+
+        HashMap<String, String> moved = TypeTraits::move(copy);
+        EXPECT_EQ(moved.size(), 49);
+        EXPECT_EQ(*moved.find("49"), "98");
+    }
+
+    TEST(HashMapTest, StringKeys) {
+        HashMap<String, int> routes;
+        for (int i = 0; i < 200; ++i) {
+            routes.insert(String("/api/v1/resources/") + decimal(i), i);
+        }
+
+        EXPECT_EQ(routes.size(), 200);
+        EXPECT_EQ(*routes.find("/api/v1/resources/7"), 7);
+        EXPECT_EQ(*routes.find(String("/api/v1/resources/1") + "99"), 199);
+        EXPECT_EQ(routes.find("/api/v1/resources/200"), nullptr);
+        EXPECT_EQ(routes.find(""), nullptr);
+
+        String key("/api/v1/resources/42");
+        EXPECT_TRUE(routes.remove(key));
+        EXPECT_FALSE(routes.contains(key));
+        routes[key] = 4242;
+        EXPECT_EQ(*routes.find(key), 4242);
+    }
 }
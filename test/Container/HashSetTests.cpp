@@ -0,0 +1,137 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/HashSet.h>
+#include <Cedar/Core/String.h>
+
+#include <vector>
+
+namespace Cedar::Core::Container {
+    // Tests insertion, membership and removal of single elements.
+    TEST(HashSetTest, InsertContainsRemove) {
+        HashSet<int> set;
+        EXPECT_TRUE(set.isEmpty());
+        EXPECT_FALSE(set.contains(1));
+
+        EXPECT_TRUE(set.insert(1));
+        EXPECT_TRUE(set.insert(2));
+        EXPECT_FALSE(set.insert(1));
+        EXPECT_EQ(set.size(), 2);
+        EXPECT_TRUE(set.contains(1));
+        EXPECT_TRUE(set.contains(2));
+        EXPECT_FALSE(set.contains(3));
+
+        EXPECT_TRUE(set.remove(1));
+        EXPECT_FALSE(set.remove(1));
+        EXPECT_FALSE(set.contains(1));
+        EXPECT_EQ(set.size(), 1);
+
+        set.clear();
+        EXPECT_TRUE(set.isEmpty());
+        EXPECT_FALSE(set.contains(2));
+    }
+
+    // Tests clearing a set that never allocated its table.
+    TEST(HashSetTest, ClearEmpty) {
+        HashSet<Int32> set;
+        set.clear();
+        EXPECT_TRUE(set.isEmpty());
+        EXPECT_TRUE(set.insert(5));
+        EXPECT_TRUE(set.contains(5));
+    }
+
+    // Tests growth well past the initial capacity together with tombstone reuse.
+    TEST(HashSetTest, GrowAndChurn) {
+        HashSet<Int64, 16> set;
+        for (Int64 i = 0; i < 50000; ++i) {
+            EXPECT_TRUE(set.insert(i * 7919));
+        }
+        EXPECT_EQ(set.size(), 50000);
+        for (Int64 i = 0; i < 50000; i += 2) {
+            EXPECT_TRUE(set.remove(i * 7919));
+        }
+        for (Int64 i = 0; i < 50000; ++i) {
+            EXPECT_EQ(set.contains(i * 7919), i % 2 == 1);
+        }
+        for (Int64 i = 0; i < 50000; i += 2) {
+            EXPECT_TRUE(set.insert(i * 7919));
+        }
+        EXPECT_EQ(set.size(), 50000);
+    }
+
+    // Tests that the batched operations agree with their single-key counterparts, including batches shorter than
+    // the prefetch window and duplicates within one batch.
+    TEST(HashSetTest, BatchedOperations) {
+        HashSet<UInt64> set;
+        std::vector<UInt64> keys;
+        for (UInt64 i = 0; i < 10000; ++i) {
+            keys.push_back(i % 3000);
+        }
+
+        EXPECT_EQ(set.insertMany(keys.data(), 3), 3);
+        EXPECT_EQ(set.insertMany(keys.data(), keys.size()), 2997);
+        EXPECT_EQ(set.size(), 3000);
+        EXPECT_EQ(set.insertMany(keys.data(), 0), 0);
+
+        std::vector<UInt64> probes;
+        for (UInt64 i = 0; i < 6001; ++i) {
+            probes.push_back(i);
+        }
+        Boolean* results = new Boolean[probes.size()];
+        set.containsMany(probes.data(), probes.size(), results);
+        for (Size i = 0; i < probes.size(); ++i) {
+            EXPECT_EQ(results[i], probes[i] < 3000);
+            EXPECT_EQ(results[i], set.contains(probes[i]));
+        }
+
+        set.containsMany(probes.data() + 2999, 2, results);
+        EXPECT_TRUE(results[0]);
+        EXPECT_FALSE(results[1]);
+        delete[] results;
+
+        HashSet<UInt64> empty;
+        Boolean result = true;
+        empty.containsMany(probes.data(), 1, &result);
+        EXPECT_FALSE(result);
+    }
+
+    // Tests non-trivial elements, copying and iteration.
+    TEST(HashSetTest, StringsCopyAndIterate) {
+        HashSet<String> set = {"alpha", "beta", "gamma"};
+        String batch[] = {"beta", "delta", "a string long enough to live on the heap"};
+        EXPECT_EQ(set.insertMany(batch, 3), 2);
+
+        HashSet<String> copy = set;
+        EXPECT_TRUE(copy.remove("alpha"));
+        EXPECT_TRUE(set.contains("alpha"));
+        EXPECT_EQ(copy.size(), 4);
+
+        Size visited = 0;
+        for (const String& element: set) {
+            EXPECT_TRUE(set.contains(element));
+            ++visited;
+        }
+        EXPECT_EQ(visited, 5);
+    }
+}
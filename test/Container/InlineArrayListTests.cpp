@@ -0,0 +1,113 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/InlineArrayList.h>
+#include <Cedar/Core/Exceptions/OutOfRangeException.h>
+#include <Cedar/Core/String.h>
+
+#include <string>
+
+namespace Cedar::Core::Container {
+    template<typename List>
+    static Boolean storedInline(const List& list) {
+        auto* begin = reinterpret_cast<const Byte*>(&list);
+        auto* data = reinterpret_cast<const Byte*>(list.data());
+        return data >= begin && data < begin + sizeof(List);
+    }
+
+    // Tests that a list stays inside the object up to N elements and spills to the heap after that.
+    TEST(InlineArrayListTest, SpillsPastInlineCapacity) {
+        InlineArrayList<int, 4> list;
+        EXPECT_EQ(list.capacity(), 4);
+
+        for (int i = 0; i < 4; ++i) {
+            list.append(i);
+        }
+        EXPECT_TRUE(storedInline(list));
+
+        list.append(4);
+        EXPECT_FALSE(storedInline(list));
+        EXPECT_GE(list.capacity(), 5);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(list[i], i);
+        }
+        EXPECT_THROW((void) list[5], OutOfRangeException);
+
+        list.removeRange(1, 3);
+        list.shrinkToFit();
+        EXPECT_TRUE(storedInline(list));
+        EXPECT_EQ(list.capacity(), 4);
+        EXPECT_EQ(list[1], 4);
+    }
+
+    // Tests copies and moves of both inline and spilled lists of non-trivial elements.
+    TEST(InlineArrayListTest, CopyAndMove) {
+        InlineArrayList<std::string, 2> small;
+        small.append("a");
+        small.emplace("b");
+
+        InlineArrayList<std::string, 2> moved = static_cast<InlineArrayList<std::string, 2>&&>(small);
+        EXPECT_TRUE(storedInline(moved));
+        EXPECT_EQ(moved[1], "b");
+        EXPECT_TRUE(small.isEmpty());
+        small.append("reused");
+        EXPECT_EQ(small[0], "reused");
+
+        InlineArrayList<std::string, 2> large;
+        for (int i = 0; i < 10; ++i) {
+            large.append(std::to_string(i));
+        }
+        const std::string* heapData = large.data();
+        InlineArrayList<std::string, 2> stolen = static_cast<InlineArrayList<std::string, 2>&&>(large);
+        EXPECT_EQ(stolen.data(), heapData);
+        EXPECT_TRUE(storedInline(large));
+
+        InlineArrayList<std::string, 2> copy = stolen;
+        copy[0] = "changed";
+        EXPECT_EQ(stolen[0], "0");
+        EXPECT_EQ(copy[9], "9");
+
+        moved = copy;
+        EXPECT_EQ(moved.size(), 10);
+        copy = static_cast<InlineArrayList<std::string, 2>&&>(small);
+        EXPECT_EQ(copy.size(), 1);
+        EXPECT_TRUE(storedInline(copy));
+    }
+
+    // Tests inserting into the middle of an inline list of Strings, which relocate by memmove.
+    TEST(InlineArrayListTest, InsertAndRemove) {
+        InlineArrayList<String, 8> parts;
+        parts.append("usr");
+        parts.append("bin");
+        parts.insertAt(1, "local");
+        parts.insertAt(0, parts[2]);
+
+        ASSERT_EQ(parts.size(), 4);
+        EXPECT_EQ(parts[0], "bin");
+        EXPECT_EQ(parts[2], "local");
+        EXPECT_TRUE(parts.remove("usr"));
+        EXPECT_EQ(parts.size(), 3);
+        EXPECT_TRUE(storedInline(parts));
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/LinkedList.h>
+
+#include <string>
+#include <vector>
+
+namespace Cedar::Core::Container {
+    namespace {
+        struct Node {
+            std::string name;
+            LinkedListHook hook;
+            LinkedListHook otherHook;
+
+            explicit Node(std::string name) : name(std::move(name)) {}
+        };
+
+        using NodeList = LinkedList<Node, &Node::hook>;
+
+        std::vector<std::string> names(const NodeList& list) {
+            std::vector<std::string> result;
+            for (const Node& node: list) {
+                result.push_back(node.name);
+            }
+            return result;
+        }
+    }
+
+    // Tests pushing at both ends, popping and the empty-list exceptions.
+    TEST(LinkedListTest, PushAndPop) {
+        Node a("a"), b("b"), c("c");
+        NodeList list;
+        EXPECT_TRUE(list.isEmpty());
+        EXPECT_THROW((void) list.front(), InvalidStateException);
+        EXPECT_THROW((void) list.popBack(), InvalidStateException);
+
+        list.pushBack(b);
+        list.pushFront(a);
+        list.pushBack(c);
+        EXPECT_EQ(list.size(), 3);
+        EXPECT_EQ(names(list), (std::vector<std::string>{"a", "b", "c"}));
+        EXPECT_EQ(list.front().name, "a");
+        EXPECT_EQ(list.back().name, "c");
+        EXPECT_THROW(list.pushBack(a), InvalidStateException);
+
+        EXPECT_EQ(&list.popFront(), &a);
+        EXPECT_EQ(&list.popBack(), &c);
+        EXPECT_FALSE(a.hook.isLinked());
+        EXPECT_TRUE(b.hook.isLinked());
+        EXPECT_EQ(names(list), (std::vector<std::string>{"b"}));
+    }
+
+    // Tests removal from the middle, insertion next to an element and moving elements to either end.
+    TEST(LinkedListTest, RemoveInsertAndMove) {
+        Node a("a"), b("b"), c("c"), d("d");
+        NodeList list;
+        list.pushBack(a);
+        list.pushBack(c);
+        list.insertBefore(c, b);
+        list.insertAfter(c, d);
+        EXPECT_EQ(names(list), (std::vector<std::string>{"a", "b", "c", "d"}));
+
+        list.moveToFront(c);
+        EXPECT_EQ(names(list), (std::vector<std::string>{"c", "a", "b", "d"}));
+        list.moveToFront(c);
+        list.moveToBack(a);
+        EXPECT_EQ(names(list), (std::vector<std::string>{"c", "b", "d", "a"}));
+
+        list.remove(b);
+        EXPECT_EQ(list.size(), 3);
+        EXPECT_FALSE(b.hook.isLinked());
+        EXPECT_EQ(names(list), (std::vector<std::string>{"c", "d", "a"}));
+
+        auto it = list.end();
+        --it;
+        EXPECT_EQ(it->name, "a");
+    }
+
+    // Tests splicing whole lists and moving a list.
+    TEST(LinkedListTest, SpliceAndMove) {
+        Node a("a"), b("b"), c("c"), d("d");
+        NodeList first, second;
+        first.pushBack(a);
+        first.pushBack(b);
+        second.pushBack(c);
+        second.pushBack(d);
+
+        first.spliceBack(second);
+        EXPECT_TRUE(second.isEmpty());
+        EXPECT_EQ(first.size(), 4);
+        EXPECT_EQ(names(first), (std::vector<std::string>{"a", "b", "c", "d"}));
+
+        second.pushBack(first.popBack());
+        first.spliceFront(second);
+        EXPECT_EQ(names(first), (std::vector<std::string>{"d", "a", "b", "c"}));
+        first.spliceBack(second);
+        EXPECT_EQ(first.size(), 4);
+
+        NodeList moved(std::move(first));
+        EXPECT_TRUE(first.isEmpty());
+        EXPECT_EQ(names(moved), (std::vector<std::string>{"d", "a", "b", "c"}));
+        moved.remove(d);
+        moved.pushBack(d);
+        EXPECT_EQ(names(moved), (std::vector<std::string>{"a", "b", "c", "d"}));
+
+        first = std::move(moved);
+        EXPECT_EQ(first.size(), 4);
+        EXPECT_EQ(&first.back(), &d);
+    }
+
+    // Tests that one element can sit in two lists through two hooks, and that clearing releases every element.
+    TEST(LinkedListTest, TwoHooksAndClear) {
+        Node a("a"), b("b");
+        NodeList byHook;
+        LinkedList<Node, &Node::otherHook> byOtherHook;
+        byHook.pushBack(a);
+        byHook.pushBack(b);
+        byOtherHook.pushBack(b);
+        byOtherHook.pushBack(a);
+        EXPECT_EQ(&byOtherHook.front(), &b);
+
+        byHook.clear();
+        EXPECT_FALSE(a.hook.isLinked());
+        EXPECT_TRUE(a.otherHook.isLinked());
+        byHook.pushBack(a);
+
+        {
+            NodeList scoped;
+            scoped.pushBack(b);
+        }
+        EXPECT_FALSE(b.hook.isLinked());
+        Node copy = a;
+        EXPECT_FALSE(copy.hook.isLinked());
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/List.h>
+#include <Cedar/Core/Exceptions/OutOfRangeException.h>
+#include <Cedar/Core/String.h>
+
+#include <string>
+
+namespace Cedar::Core::Container {
+    // Tests indexed access and iteration across many segments.
+    TEST(ListTest, AppendIndexAndIterate) {
+        List<int> list;
+        EXPECT_TRUE(list.isEmpty());
+        for (int i = 0; i < 100000; ++i) {
+            list.append(i);
+        }
+
+        ASSERT_EQ(list.size(), 100000);
+        for (int i = 0; i < 100000; i += 997) {
+            EXPECT_EQ(list[i], i);
+        }
+        EXPECT_EQ(list[7], 7);
+        EXPECT_EQ(list[8], 8);
+        EXPECT_EQ(list[99999], 99999);
+        EXPECT_THROW((void) list[100000], OutOfRangeException);
+
+        long long sum = 0;
+        int expected = 0;
+        for (int value : list) {
+            EXPECT_EQ(value, expected++);
+            sum += value;
+        }
+        EXPECT_EQ(expected, 100000);
+        EXPECT_EQ(sum, 100000LL * 99999 / 2);
+    }
+
+    // Tests iterating empty lists, both never allocated and emptied by clear().
+    TEST(ListTest, IterateEmpty) {
+        List<int> list;
+        EXPECT_EQ(list.begin(), list.end());
+        for (int value : list) {
+            ADD_FAILURE() << value;
+        }
+
+        list.append(1);
+        list.clear();
+        const List<int>& view = list;
+        EXPECT_EQ(view.begin(), view.end());
+    }
+
+    // Tests that appending never moves elements that are already in the list.
+    TEST(ListTest, ReferencesStayValid) {
+        List<std::string> list;
+        std::string& first = list.emplace("first");
+        const std::string* addressOfTenth = nullptr;
+        for (int i = 1; i < 5000; ++i) {
+            list.append(std::to_string(i));
+            if (i == 10) {
+                addressOfTenth = &list[10];
+            }
+        }
+
+        EXPECT_EQ(first, "first");
+        EXPECT_EQ(&list[0], &first);
+        EXPECT_EQ(&list[10], addressOfTenth);
+    }
+
+    // Tests remove, clear, copies and moves.
+    TEST(ListTest, RemoveCopyAndMove) {
+        List<String> list;
+        for (int i = 0; i < 20; ++i) {
+            list.append(String(std::to_string(i).c_str()));
+        }
+
+        EXPECT_TRUE(list.remove("7"));
+        EXPECT_FALSE(list.remove("7"));
+        ASSERT_EQ(list.size(), 19);
+        EXPECT_EQ(list[7], "8");
+        EXPECT_EQ(list[18], "19");
+        list.append("20");
+        EXPECT_EQ(list[19], "20");
+
+        List<String> copy = list;
+        copy[0] = "zero";
+        EXPECT_EQ(list[0], "0");
+        EXPECT_EQ(copy.size(), 20);
+
+        List<String> moved = static_cast<List<String>&&>(copy);
+        EXPECT_EQ(moved[0], "zero");
+        EXPECT_TRUE(copy.isEmpty());
+
+        list = moved;
+        list.clear();
+        EXPECT_EQ(list.size(), 0);
+        EXPECT_EQ(list.begin(), list.end());
+        list.append("again");
+        EXPECT_EQ(list[0], "again");
+        EXPECT_EQ(moved.size(), 20);
+    }
+}
@@ -0,0 +1,233 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/LruCache.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+namespace Cedar::Core::Container {
+    // Tests that the least recently used entry is evicted and that hits refresh recency.
+    TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+        LruCache<int, int> cache(3, CachePolicy::Lru, 1);
+        cache.put(1, 10);
+        cache.put(2, 20);
+        cache.put(3, 30);
+
+        int value = 0;
+        EXPECT_TRUE(cache.get(1, value));
+        EXPECT_EQ(value, 10);
+        cache.put(4, 40);
+
+        EXPECT_FALSE(cache.get(2, value));
+        EXPECT_TRUE(cache.get(1, value));
+        EXPECT_TRUE(cache.get(3, value));
+        EXPECT_TRUE(cache.get(4, value));
+        EXPECT_EQ(cache.size(), 3);
+
+        CacheStatistics statistics = cache.statistics();
+        EXPECT_EQ(statistics.hits, 4);
+        EXPECT_EQ(statistics.misses, 1);
+        EXPECT_EQ(statistics.evictions, 1);
+    }
+
+    // Tests that CLOCK gives referenced entries a second chance and evicts in insertion order otherwise.
+    TEST(LruCacheTest, ClockSecondChance) {
+        LruCache<int, int> cache(3, CachePolicy::Clock, 1);
+        cache.put(1, 10);
+        cache.put(2, 20);
+        cache.put(3, 30);
+
+        int value = 0;
+        EXPECT_TRUE(cache.get(1, value));
+        cache.put(4, 40);
+        EXPECT_TRUE(cache.get(1, value));
+        EXPECT_FALSE(cache.get(2, value));
+
+        cache.put(5, 50);
+        EXPECT_FALSE(cache.get(3, value));
+        EXPECT_TRUE(cache.get(4, value));
+        EXPECT_TRUE(cache.get(5, value));
+        EXPECT_EQ(cache.statistics().evictions, 2);
+    }
+
+    // Tests replacement, removal, clearing and reuse of recycled entries.
+    TEST(LruCacheTest, ReplaceRemoveAndClear) {
+        LruCache<int, String> cache(400, CachePolicy::Lru, 4);
+        EXPECT_EQ(cache.shardCount(), 4);
+        cache.put(1, "one");
+        cache.put(1, "uno");
+        String value;
+        EXPECT_TRUE(cache.get(1, value));
+        EXPECT_EQ(value, "uno");
+        EXPECT_EQ(cache.size(), 1);
+
+        EXPECT_TRUE(cache.remove(1));
+        EXPECT_FALSE(cache.remove(1));
+        EXPECT_EQ(cache.weight(), 0);
+
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 20; ++i) {
+                cache.put(i, "v");
+            }
+            EXPECT_EQ(cache.size(), 20);
+            cache.clear();
+            EXPECT_EQ(cache.size(), 0);
+        }
+        EXPECT_FALSE(cache.get(0, value));
+        EXPECT_THROW((LruCache<int, int>(0)), InvalidArgumentException);
+    }
+
+    // Tests destroying and clearing caches whose shards were never all used.
+    TEST(LruCacheTest, UnusedShards) {
+        {
+            LruCache<Int32, Int32> cache(4096);
+            EXPECT_EQ(cache.shardCount(), 16);
+        }
+        {
+            LruCache<Int32, Int32> cache(4096);
+            cache.put(1, 1);
+        }
+
+        LruCache<Int32, Int32> cache(4096);
+        cache.clear();
+        EXPECT_EQ(cache.size(), 0);
+        cache.put(1, 1);
+        cache.clear();
+        Int32 value;
+        EXPECT_FALSE(cache.get(1, value));
+    }
+
+    // Tests that small caches use fewer shards and that shard capacities add up to the requested capacity.
+    TEST(LruCacheTest, ShardSizing) {
+        EXPECT_EQ((LruCache<Int32, Int32>(4).shardCount()), 1);
+        EXPECT_EQ((LruCache<Int32, Int32>(4).capacity()), 4);
+        EXPECT_EQ((LruCache<Int32, Int32>(100).shardCount()), 1);
+        EXPECT_EQ((LruCache<Int32, Int32>(100).capacity()), 100);
+        EXPECT_EQ((LruCache<Int32, Int32>(300).shardCount()), 4);
+        EXPECT_EQ((LruCache<Int32, Int32>(300).maxEntryWeight()), 75);
+        EXPECT_EQ((LruCache<Int32, Int32>(1000, CachePolicy::Lru, 64).shardCount()), 8);
+
+        // 1003 = 8 * 125 + 3: three shards take one extra unit each.
+        LruCache<Int32, Int32> cache(1003, CachePolicy::Lru, 8);
+        EXPECT_EQ(cache.capacity(), 1003);
+        EXPECT_EQ(cache.maxEntryWeight(), 125);
+        for (Int32 i = 0; i < 100000; ++i) {
+            cache.put(i, i);
+        }
+        EXPECT_EQ(cache.size(), 1003);
+    }
+
+    // Tests that default-sharded caches keep strings charged by length, and the per-shard admission limit.
+    TEST(LruCacheTest, WeightedAdmission) {
+        LruCache<Int32, String> small(100);
+        small.put(1, "ten bytes!");
+        String value;
+        EXPECT_TRUE(small.get(1, value));
+        EXPECT_EQ(small.size(), 1);
+        for (Int32 i = 0; i < 20; ++i) {
+            small.put(i, "ten bytes!");
+        }
+        EXPECT_EQ(small.weight(), 100);
+
+        // A value may take a whole shard, evicting everything else in it, but nothing heavier is admitted.
+        LruCache<Int32, String> sharded(256, CachePolicy::Lru, 4);
+        ASSERT_EQ(sharded.maxEntryWeight(), 64);
+        String fits("0123456789012345678901234567890123456789012345678901234567890123");
+        sharded.put(7, fits);
+        EXPECT_TRUE(sharded.get(7, value));
+        sharded.put(7, fits + "!");
+        EXPECT_FALSE(sharded.get(7, value));
+        EXPECT_EQ(sharded.weight(), 0);
+    }
+
+    // Tests weight-based capacity, with strings charged by their byte length.
+    TEST(LruCacheTest, WeightedCapacity) {
+        LruCache<int, String> cache(10, CachePolicy::Lru, 1);
+        cache.put(1, "aaaa");
+        cache.put(2, "bbbb");
+        EXPECT_EQ(cache.weight(), 8);
+
+        cache.put(3, "cccc");
+        EXPECT_EQ(cache.size(), 2);
+        EXPECT_EQ(cache.weight(), 8);
+        String value;
+        EXPECT_FALSE(cache.get(1, value));
+
+        cache.put(2, "bbbbbbbbb");
+        EXPECT_EQ(cache.size(), 1);
+        EXPECT_EQ(cache.weight(), 9);
+
+        // Too heavy for the cache: not stored, and the stale value for the key is dropped.
+        cache.put(2, "xxxxxxxxxxx");
+        EXPECT_FALSE(cache.get(2, value));
+        EXPECT_EQ(cache.weight(), 0);
+
+        // Empty strings still count, so the number of entries stays bounded.
+        for (int i = 0; i < 100; ++i) {
+            cache.put(i, "");
+        }
+        EXPECT_EQ(cache.size(), 10);
+    }
+
+    // Tests concurrent use of a sharded cache; every hit must return the value stored for its key.
+    TEST(LruCacheTest, ConcurrentAccess) {
+        for (CachePolicy policy : {CachePolicy::Lru, CachePolicy::Clock}) {
+            LruCache<int, int> cache(256, policy, 8);
+            constexpr int Threads = 4;
+            constexpr int Operations = 20000;
+            bool valid[Threads] = {};
+            Threading::Thread* threads[Threads];
+            for (int t = 0; t < Threads; ++t) {
+                Function<void> body = [&cache, &valid, t]() {
+                    bool ok = true;
+                    for (int i = 0; i < Operations; ++i) {
+                        int key = (i * 7 + t * 13) % 1000;
+                        int value;
+                        if (cache.get(key, value)) {
+                            ok &= value == key * 3;
+                        } else {
+                            cache.put(key, key * 3);
+                        }
+                    }
+                    valid[t] = ok;
+                };
+                threads[t] = new Threading::Thread(body);
+            }
+            for (auto thread : threads) {
+                thread->start();
+            }
+            for (auto thread : threads) {
+                thread->join();
+                delete thread;
+            }
+
+            for (bool ok : valid) {
+                EXPECT_TRUE(ok);
+            }
+            CacheStatistics statistics = cache.statistics();
+            EXPECT_EQ(statistics.hits + statistics.misses, Threads * Operations);
+            EXPECT_LE(cache.weight(), cache.capacity());
+            EXPECT_EQ(cache.size(), cache.weight());
+        }
+    }
+}
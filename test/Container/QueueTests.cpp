@@ -0,0 +1,197 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/Queue.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <atomic>
+#include <string>
+
+namespace Cedar::Core::Container {
+    // Runs producers that push 1..perProducer each and consumers that pop until every item is accounted for, then
+    // checks that the sum of everything popped matches.
+    template<typename QueueType>
+    static void runProducersAndConsumers(QueueType& queue, int producers, int consumers, int perProducer) {
+        std::atomic<long long> popped(0);
+        std::atomic<long long> sum(0);
+        long long total = static_cast<long long>(producers) * perProducer;
+
+        Threading::Thread* threads[16];
+        int threadCount = 0;
+        for (int p = 0; p < producers; ++p) {
+            Function<void> produce = [&queue, perProducer]() {
+                for (int i = 1; i <= perProducer; ++i) {
+                    queue.push(i);
+                }
+            };
+            threads[threadCount++] = new Threading::Thread(produce);
+        }
+        for (int c = 0; c < consumers; ++c) {
+            Function<void> consume = [&queue, &popped, &sum, total]() {
+                while (popped.load() < total) {
+                    int value;
+                    if (queue.tryPop(value)) {
+                        sum.fetch_add(value);
+                        popped.fetch_add(1);
+                    } else {
+                        Threading::Thread::yield();
+                    }
+                }
+            };
+            threads[threadCount++] = new Threading::Thread(consume);
+        }
+        for (int t = 0; t < threadCount; ++t) {
+            threads[t]->start();
+        }
+        for (int t = 0; t < threadCount; ++t) {
+            threads[t]->join();
+            delete threads[t];
+        }
+
+        EXPECT_EQ(popped.load(), total);
+        EXPECT_EQ(sum.load(), static_cast<long long>(producers) * perProducer * (perProducer + 1) / 2);
+    }
+
+    // Tests FIFO order, the power-of-two capacity and the full and empty conditions.
+    TEST(QueueTest, FifoAndBounds) {
+        Queue<int> queue(5);
+        EXPECT_EQ(queue.capacity(), 8);
+        EXPECT_THROW(Queue<int>(0), InvalidArgumentException);
+
+        int value = 0;
+        EXPECT_FALSE(queue.tryPop(value));
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_TRUE(queue.tryPush(i));
+        }
+        EXPECT_FALSE(queue.tryPush(8));
+        EXPECT_EQ(queue.approximateSize(), 8);
+
+        for (int lap = 0; lap < 3; ++lap) {
+            for (int i = 0; i < 8; ++i) {
+                ASSERT_TRUE(queue.tryPop(value));
+                EXPECT_EQ(value, lap * 8 + i);
+                EXPECT_TRUE(queue.tryPush(lap * 8 + i + 8));
+            }
+        }
+        EXPECT_EQ(queue.approximateSize(), 8);
+    }
+
+    // Tests that items left in a queue are destroyed with it, for all three variants.
+    TEST(QueueTest, DestroysRemainingItems) {
+        std::string text(100, 'q');
+        Queue<std::string> queue(4);
+        MpscQueue<std::string> mpsc(4);
+        SpscQueue<std::string> spsc(4);
+        for (int i = 0; i < 3; ++i) {
+            queue.push(text);
+            mpsc.push(text);
+            spsc.push(text);
+        }
+
+        std::string out;
+        spsc.pop(out);
+        EXPECT_EQ(out, text);
+        EXPECT_TRUE(mpsc.tryEmplace(5, 'x'));
+        EXPECT_FALSE(mpsc.tryEmplace(5, 'x'));
+    }
+
+    namespace {
+        // Constructing from a negative number throws; moving never does.
+        struct Fragile {
+            int value = 0;
+
+            Fragile() = default;
+
+            explicit Fragile(int value) : value(value) {
+                if (value < 0) {
+                    throw InvalidArgumentException("Negative value");
+                }
+            }
+        };
+
+        template<typename QueueType>
+        void expectSurvivesThrowingEmplace(QueueType& queue) {
+            EXPECT_THROW((void) queue.tryEmplace(-1), InvalidArgumentException);
+            EXPECT_TRUE(queue.tryEmplace(1));
+            EXPECT_THROW((void) queue.tryEmplace(-2), InvalidArgumentException);
+            EXPECT_TRUE(queue.tryPush(Fragile(2)));
+
+            Fragile out;
+            ASSERT_TRUE(queue.tryPop(out));
+            EXPECT_EQ(out.value, 1);
+            ASSERT_TRUE(queue.tryPop(out));
+            EXPECT_EQ(out.value, 2);
+            EXPECT_FALSE(queue.tryPop(out));
+        }
+    }
+
+    // Tests that a constructor throwing inside tryEmplace leaves every queue variant usable, with no lost slot.
+    TEST(QueueTest, ThrowingEmplace) {
+        Queue<Fragile> queue(4);
+        MpscQueue<Fragile> mpsc(4);
+        SpscQueue<Fragile> spsc(4);
+        expectSurvivesThrowingEmplace(queue);
+        expectSurvivesThrowingEmplace(mpsc);
+        expectSurvivesThrowingEmplace(spsc);
+    }
+
+    // Tests several producers and consumers sharing a small queue, so both sides often find it full or empty.
+    TEST(QueueTest, MultipleProducersAndConsumers) {
+        Queue<int> queue(64);
+        runProducersAndConsumers(queue, 4, 4, 20000);
+    }
+
+    // Tests several producers feeding a single consumer.
+    TEST(QueueTest, MultipleProducersSingleConsumer) {
+        MpscQueue<int> queue(64);
+        runProducersAndConsumers(queue, 4, 1, 20000);
+    }
+
+    // Tests that a single producer and consumer see items in order.
+    TEST(QueueTest, SingleProducerSingleConsumer) {
+        constexpr int Count = 200000;
+        SpscQueue<int> queue(16);
+        std::atomic<int> outOfOrder(0);
+
+        Function<void> consume = [&queue, &outOfOrder]() {
+            for (int expected = 0; expected < Count; ++expected) {
+                int value;
+                queue.pop(value);
+                if (value != expected) {
+                    outOfOrder.fetch_add(1);
+                }
+            }
+        };
+        Threading::Thread consumer(consume);
+        consumer.start();
+        for (int i = 0; i < Count; ++i) {
+            queue.push(i);
+        }
+        consumer.join();
+
+        EXPECT_EQ(outOfOrder.load(), 0);
+        EXPECT_EQ(queue.approximateSize(), 0);
+    }
+}
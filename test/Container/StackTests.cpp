@@ -0,0 +1,67 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Container/Stack.h>
+
+#include <string>
+
+namespace Cedar::Core::Container {
+    // Tests LIFO order and access to the top element.
+    TEST(StackTest, PushAndPop) {
+        Stack<int> stack;
+        EXPECT_TRUE(stack.isEmpty());
+        for (int i = 0; i < 100; ++i) {
+            stack.push(i);
+        }
+
+        EXPECT_EQ(stack.size(), 100);
+        EXPECT_EQ(stack.top(), 99);
+        stack.top() = 1000;
+        EXPECT_EQ(stack.pop(), 1000);
+        for (int i = 98; i >= 0; --i) {
+            EXPECT_EQ(stack.pop(), i);
+        }
+        EXPECT_TRUE(stack.isEmpty());
+        EXPECT_THROW((void) stack.pop(), InvalidStateException);
+        EXPECT_THROW((void) stack.top(), InvalidStateException);
+    }
+
+    // Tests emplace, tryPop and clear with non-trivial elements.
+    TEST(StackTest, EmplaceAndTryPop) {
+        Stack<std::string> stack(4);
+        stack.emplace(3, 'a');
+        stack.push("b");
+
+        std::string out;
+        ASSERT_TRUE(stack.tryPop(out));
+        EXPECT_EQ(out, "b");
+        ASSERT_TRUE(stack.tryPop(out));
+        EXPECT_EQ(out, "aaa");
+        EXPECT_FALSE(stack.tryPop(out));
+
+        stack.push("c");
+        stack.clear();
+        EXPECT_EQ(stack.size(), 0);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Hashing.h>
+#include <Cedar/Core/Memory.h>
+#include <Cedar/Core/String.h>
+#include <Cedar/Core/StringView.h>
+#include <Cedar/Core/Container/HashMap.h>
+
+namespace Cedar::Core {
+
+    // Tests that the byte hasher depends on every byte, the length and the seed.
+    TEST(HashingTest, HashBytes) {
+        const char text[] = "the quick brown fox jumps over the lazy dog, twice over";
+        Size size = sizeof(text) - 1;
+        UInt64 base = Hashing::hashBytes(text, size);
+
+        EXPECT_EQ(base, Hashing::hashBytes(text, size));
+        EXPECT_NE(base, Hashing::hashBytes(text, size, 1));
+        EXPECT_NE(Hashing::hashBytes("", 0), Hashing::hashBytes("\0", 1));
+
+        for (Size length = 0; length < size; ++length) {
+            EXPECT_NE(Hashing::hashBytes(text, length), Hashing::hashBytes(text, length + 1));
+        }
+
+        char copy[sizeof(text)];
+        for (Size i = 0; i < size; ++i) {
+            for (Size bit = 0; bit < 8; ++bit) {
+                Memory::copy(copy, text, size);
+                copy[i] = static_cast<char>(copy[i] ^ (1 << bit));
+                EXPECT_NE(base, Hashing::hashBytes(copy, size));
+            }
+        }
+    }
+
+    // Tests that sequential integers spread evenly over the low bits that hash tables mask with.
+    TEST(HashingTest, IntegerDistribution) {
+        constexpr Size Buckets = 64;
+        constexpr Size Keys = Buckets * 256;
+        Size counts[Buckets] = {};
+
+        for (UInt64 key = 0; key < Keys; ++key) {
+            ++counts[hash<UInt64>(key * Buckets) % Buckets];
+        }
+        for (Size count : counts) {
+            EXPECT_GT(count, 256 / 2);
+            EXPECT_LT(count, 256 * 2);
+        }
+        EXPECT_EQ(hash<Float64>(0.0), hash<Float64>(-0.0));
+    }
+
+    // Tests that String and StringView hash the same text to the same value, whatever the storage.
+    TEST(HashingTest, StringHashes) {
+        String shortText("key");
+        String longText("a string that is too long to be stored inline");
+
+        EXPECT_EQ(hash<String>(shortText), hash<StringView>(StringView(shortText)));
+        EXPECT_EQ(hash<String>(longText), hash<StringView>(StringView(longText)));
+        EXPECT_EQ(hash<String>(longText), hash<String>(longText));
+        EXPECT_EQ(hash<String>(longText), hash<String>(String(longText)));
+        EXPECT_NE(hash<String>(shortText), hash<String>("kez"));
+        EXPECT_EQ(hash<String>(String()), hash<StringView>(StringView()));
+    }
+
+    // Tests that Pair and Tuple work as hash map keys and that their hashes depend on element order.
+    TEST(HashingTest, CompositeKeys) {
+        using Point = Container::Pair<Int32, Int32>;
+        Container::HashMap<Point, Int32> grid;
+        for (Int32 x = 0; x < 32; ++x) {
+            for (Int32 y = 0; y < 32; ++y) {
+                grid.insert(Point(x, y), x * 32 + y);
+            }
+        }
+
+        EXPECT_EQ(grid.size(), 32 * 32);
+        EXPECT_EQ(grid[Point(3, 7)], 3 * 32 + 7);
+        EXPECT_EQ(grid[Point(7, 3)], 7 * 32 + 3);
+        EXPECT_NE(KeyHash<Point>()(Point(3, 7)), KeyHash<Point>()(Point(7, 3)));
+
+        using Key = Container::Tuple<String, Int32, Boolean>;
+        Container::HashMap<Key, Int32> map;
+        map.insert(Key("a", 1, true), 1);
+        map.insert(Key("a", 1, false), 2);
+        map.insert(Key("b", 1, true), 3);
+
+        EXPECT_EQ(map.size(), 3);
+        EXPECT_EQ(map[Key("a", 1, false)], 2);
+        EXPECT_TRUE(map.contains(Key("b", 1, true)));
+        EXPECT_FALSE(map.contains(Key("b", 2, true)));
+    }
+}
@@ -37,6 +37,15 @@ namespace Cedar::Core::IO {
         EXPECT_EQ(p.toString(), "C:/Users/Test/File.txt");  // Path should be normalized to forward slashes.
     }
 
+    // Test that repeated separators collapse into one.
+    TEST(PathTest, NormalizeRepeatedSeparators) {
+        Path p("usr///local\\\\bin//");
+        EXPECT_EQ(p.toString(), "usr/local/bin/");
+
+        Path network("//server/share");
+        EXPECT_EQ(network.toString(), "//server/share");
+    }
+
     // Test extraction of the file name from a full path.
     TEST(PathTest, GetFileName) {
         Path p("C:/Users/Test/File.txt");
@@ -0,0 +1,82 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/StringBuilder.h>
+
+namespace Cedar::Core {
+
+    // Tests appending strings, C strings and runes.
+    TEST(StringBuilderTest, AppendMixedContent) {
+        StringBuilder builder;
+        builder.append("Hello").append(String(", ")).append(U'世').append(U'界').append("!?", 1);
+
+        EXPECT_EQ(builder.length(), 10);
+        EXPECT_EQ(builder.rawLength(), 14);
+
+        String result = builder.build();
+        EXPECT_EQ(result, "Hello, 世界!");
+        EXPECT_EQ(result.length(), 10);
+        EXPECT_EQ(builder.rawLength(), 0);
+    }
+
+    // Tests growth past the inline limit and that the builder is reusable after build().
+    TEST(StringBuilderTest, GrowAndReuse) {
+        StringBuilder builder(4);
+        EXPECT_GE(builder.capacity(), 4);
+
+        for (int i = 0; i < 1000; ++i) {
+            builder.append(static_cast<Rune>('a' + i % 26));
+        }
+        EXPECT_GE(builder.capacity(), 1000);
+
+        String longResult = builder.build();
+        EXPECT_EQ(longResult.length(), 1000);
+        EXPECT_EQ(longResult[27], 'b');
+        EXPECT_EQ(longResult.substring(990), "cdefghijkl");
+
+        builder.append("again");
+        EXPECT_EQ(builder.build(), "again");
+        EXPECT_EQ(builder.build(), "");
+    }
+
+    // Tests that reserve keeps the existing content.
+    TEST(StringBuilderTest, ReserveKeepsContent) {
+        StringBuilder builder;
+        builder.append("keep");
+        builder.reserve(256);
+        EXPECT_GE(builder.capacity(), 256);
+        builder.append(" me");
+        EXPECT_EQ(builder.build(), "keep me");
+    }
+
+    // Tests building before anything was appended, when the builder has no buffer yet.
+    TEST(StringBuilderTest, BuildEmpty) {
+        StringBuilder builder;
+        String empty = builder.build();
+        EXPECT_EQ(empty, "");
+        EXPECT_EQ(empty.length(), 0);
+        builder.append("next");
+        EXPECT_EQ(builder.build(), "next");
+    }
+}
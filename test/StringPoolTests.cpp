@@ -0,0 +1,131 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/StringPool.h>
+#include <Cedar/Core/Container/HashMap.h>
+#include <Cedar/Core/Exceptions/OutOfRangeException.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <atomic>
+#include <string>
+
+namespace Cedar::Core {
+
+    // Tests that equal text interns to the same symbol and that views point into the pool rather than the input.
+    TEST(StringPoolTest, InternDeduplicates) {
+        StringPool pool;
+        String label("service.name");
+
+        Symbol first = pool.intern(label);
+        Symbol second = pool.intern("service.name");
+        Symbol other = pool.intern("service.version");
+
+        EXPECT_EQ(first, second);
+        EXPECT_NE(first, other);
+        EXPECT_EQ(pool.size(), 3);
+        EXPECT_EQ(pool.view(first), "service.name");
+        EXPECT_NE(pool.view(first).rawData(), label.rawString());
+        EXPECT_EQ(pool.view(first).rawData(), pool.view(second).rawData());
+        EXPECT_EQ(pool.toString(other), "service.version");
+    }
+
+    // Tests that the default symbol is the empty string and that lookups do not intern.
+    TEST(StringPoolTest, EmptyAndFind) {
+        StringPool pool;
+        Symbol symbol(99);
+
+        EXPECT_EQ(pool.intern(""), Symbol());
+        EXPECT_TRUE(pool.view(Symbol()).isEmpty());
+        EXPECT_FALSE(pool.find("région", symbol));
+        EXPECT_EQ(pool.size(), 1);
+
+        Symbol interned = pool.intern("région");
+        EXPECT_TRUE(pool.find("région", symbol));
+        EXPECT_EQ(symbol, interned);
+        EXPECT_EQ(pool.view(symbol).length(), 6);
+        EXPECT_THROW((void) pool.view(Symbol(1000)), OutOfRangeException);
+    }
+
+    // Tests that views stay valid while the pool grows across arena chunks and entry segments.
+    TEST(StringPoolTest, ViewsSurviveGrowth) {
+        StringPool pool;
+        Container::HashMap<Symbol, std::string> expected;
+        Symbol firstSymbol = pool.intern("label-0");
+        StringView firstView = pool.view(firstSymbol);
+
+        for (int i = 0; i < 20000; ++i) {
+            std::string text = "label-" + std::to_string(i);
+            expected.insert(pool.intern(StringView(text.c_str(), text.size())), text);
+        }
+        std::string large(100000, 'x');
+        Symbol largeSymbol = pool.intern(StringView(large.c_str(), large.size()));
+
+        EXPECT_EQ(pool.size(), 20002);
+        EXPECT_EQ(pool.view(firstSymbol).rawData(), firstView.rawData());
+        EXPECT_EQ(pool.view(largeSymbol).rawLength(), large.size());
+        EXPECT_GE(pool.arenaSize(), large.size());
+        for (auto entry : expected) {
+            ASSERT_EQ(pool.toString(entry.first), String(entry.second.c_str()));
+        }
+    }
+
+    // Tests threads interning overlapping label sets: every thread must see the same symbol for the same text.
+    TEST(StringPoolTest, ConcurrentIntern) {
+        constexpr int Threads = 4;
+        constexpr int Labels = 5000;
+
+        StringPool pool;
+        Symbol seen[Threads][Labels];
+        std::atomic<int> mismatches(0);
+
+        Threading::Thread* threads[Threads];
+        for (int t = 0; t < Threads; ++t) {
+            Function<void> work = [&pool, &seen, &mismatches, t]() {
+                for (int i = 0; i < Labels; ++i) {
+                    int label = (i + t * 1237) % Labels;
+                    std::string text = "tag:" + std::to_string(label);
+                    Symbol symbol = pool.intern(StringView(text.c_str(), text.size()));
+                    if (pool.view(symbol) != StringView(text.c_str(), text.size())) {
+                        mismatches.fetch_add(1);
+                    }
+                    seen[t][label] = symbol;
+                }
+            };
+            threads[t] = new Threading::Thread(work);
+            threads[t]->start();
+        }
+        for (auto* thread : threads) {
+            thread->join();
+            delete thread;
+        }
+
+        EXPECT_EQ(mismatches.load(), 0);
+        EXPECT_EQ(pool.size(), Labels + 1);
+        for (int i = 0; i < Labels; ++i) {
+            for (int t = 1; t < Threads; ++t) {
+                ASSERT_EQ(seen[t][i], seen[0][i]);
+            }
+        }
+    }
+}
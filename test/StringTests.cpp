@@ -24,6 +24,7 @@
 #include <gtest/gtest.h>
 #include <Cedar/Core/String.h>
 #include <Cedar/Core/Container/List.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
 #include <Cedar/Core/Exceptions/InvalidStateException.h>
 
 namespace Cedar::Core {
@@ -61,6 +62,48 @@ namespace Cedar::Core {
         EXPECT_THROW(original.length(), InvalidStateException);
     }
 
+    // Tests strings on both sides of the inline storage limit.
+    TEST(StringTest, InlineAndHeapStorage) {
+        String shortStr("short key");
+        String longStr("a considerably longer string that lives on the heap");
+        EXPECT_EQ(shortStr.length(), 9);
+        EXPECT_EQ(longStr.length(), 51);
+
+        String joined = shortStr + " / " + longStr;
+        EXPECT_STREQ(joined.rawString(), "short key / a considerably longer string that lives on the heap");
+        EXPECT_EQ(joined.length(), 63);
+
+        String copy(longStr);
+        EXPECT_EQ(copy, longStr);
+        String moved(std::move(copy));
+        EXPECT_EQ(moved, longStr);
+        EXPECT_THROW((void) copy.length(), InvalidStateException);
+
+        moved = shortStr;
+        EXPECT_EQ(moved, shortStr);
+        shortStr = longStr;
+        EXPECT_EQ(shortStr.length(), longStr.length());
+        EXPECT_STREQ(shortStr.rawString(), longStr.rawString());
+
+        String unicode("世界世界世界世界世界");
+        EXPECT_EQ(unicode.rawLength(), 30);
+        EXPECT_EQ(unicode.length(), 10);
+        EXPECT_EQ(unicode.at(-1), u'界');
+    }
+
+    // Tests that malformed UTF-8 is rejected, in short and long strings alike.
+    TEST(StringTest, RejectsMalformedUtf8) {
+        EXPECT_THROW(String("\xC3"), InvalidArgumentException);
+        EXPECT_THROW(String("\xC0\xAF"), InvalidArgumentException);
+        EXPECT_THROW(String("\xED\xA0\x80"), InvalidArgumentException);
+        EXPECT_THROW(String("\xF4\x90\x80\x80"), InvalidArgumentException);
+        EXPECT_THROW(String("a perfectly fine ascii prefix, then \x80"), InvalidArgumentException);
+        EXPECT_THROW(String("truncated four-byte rune at the very end \xF0\x9F\x8C"), InvalidArgumentException);
+
+        String longText("mixed 🌍 content, 世界 and more ascii text to cross several vector blocks é");
+        EXPECT_EQ(longText.length(), 72);
+    }
+
     // Tests handling of Unicode characters in strings.
     TEST(StringTest, UnicodeHandling) {
         String unicode("你好🌍");
@@ -94,6 +137,31 @@ namespace Cedar::Core {
         EXPECT_THROW(testStr.at(-testStr.length() - 1), OutOfRangeException);
     }
 
+    // Tests random rune access and slicing on long mixed-width strings.
+    TEST(StringTest, IndexedAccessOnLongStrings) {
+        String pattern("aé世🌍");
+        String text;
+        for (int i = 0; i < 100; ++i) {
+            text = text + pattern;
+        }
+        ASSERT_EQ(text.length(), 400);
+
+        Rune expected[] = {U'a', U'é', U'世', U'🌍'};
+        for (SSize i = 399; i >= 0; --i) {
+            EXPECT_EQ(text[i], expected[i % 4]);
+        }
+        EXPECT_EQ(text.at(-400), U'a');
+
+        EXPECT_EQ(text.substring(130, 4), "世🌍aé");
+        EXPECT_EQ(text.substring(396), pattern);
+        EXPECT_EQ(text.substring(400), "");
+        EXPECT_EQ(text.substring(0, 1000), text);
+
+        String ascii("0123456789012345678901234567890123456789");
+        EXPECT_EQ(ascii[37], '7');
+        EXPECT_EQ(ascii.substring(35, 3), "567");
+    }
+
     // Tests various string manipulation operations.
     TEST(StringTest, StringOperations) {
         String s("  trim me  ");
@@ -153,6 +221,13 @@ namespace Cedar::Core {
 
         result = original.replace("world", "🌏");
         ASSERT_EQ(result, "hello 🌏");
+
+        result = String("a-b-c-d").replace("-", "::");
+        ASSERT_EQ(result, "a::b::c::d");
+
+        result = String("ööö").replace("ö", "oe");
+        ASSERT_EQ(result, "oeoeoe");
+        ASSERT_EQ(result.length(), 6);
     }
 
     // Tests string search and position finding.
@@ -178,4 +253,177 @@ namespace Cedar::Core {
         EXPECT_EQ(pathStr.find(String("/"), 1), 4);
         EXPECT_EQ(pathStr.find(String("/"), 0), 0);
     }
+
+    // Tests forward and backward search against a brute-force scan over block boundaries and long needles.
+    TEST(StringFindTest, FindMatchesBruteForce) {
+        String text;
+        for (int i = 0; i < 40; ++i) {
+            text = text + "ab世c🌍abcab" + String(static_cast<Rune>('a' + i % 3));
+        }
+        String needles[] = {"a", "ab", "🌍", "c🌍a", "bab世", "cab世c🌍abcab", "ab世c🌍abcabaab世c🌍abcabbab世c🌍abcabc", "zz"};
+
+        Size length = text.length();
+        for (const String& needle : needles) {
+            Size needleLength = needle.length();
+            for (Size start = 0; start < length; start += 7) {
+                SSize expected = String::NPos;
+                for (Size i = start; i + needleLength <= length && expected == String::NPos; ++i) {
+                    if (text.substring(i, needleLength) == needle) expected = static_cast<SSize>(i);
+                }
+                EXPECT_EQ(text.find(needle, static_cast<SSize>(start)), expected);
+
+                SSize expectedLast = String::NPos;
+                for (SSize i = static_cast<SSize>(start); i >= 0 && expectedLast == String::NPos; --i) {
+                    if (i + needleLength <= length && text.substring(i, needleLength) == needle) expectedLast = i;
+                }
+                EXPECT_EQ(text.find(needle, static_cast<SSize>(start) - static_cast<SSize>(length)), expectedLast);
+            }
+        }
+
+        EXPECT_TRUE(text.contains("c🌍abcabc"));
+        EXPECT_FALSE(text.contains("🌍🌍"));
+    }
+
+    // Tests splitting on multi-byte delimiters.
+    TEST(StringTest, SplitOnMultiByteDelimiter) {
+        String s("α→β→→γ");
+        auto parts = s.split("→");
+        ASSERT_EQ(parts.size(), 4);
+        EXPECT_EQ(parts[0], "α");
+        EXPECT_EQ(parts[1], "β");
+        EXPECT_EQ(parts[2], "");
+        EXPECT_EQ(parts[3], "γ");
+    }
+
+    // Tests iterating over runes forwards and backwards.
+    TEST(StringTest, RuneIterator) {
+        String s("aé中🌍");
+        Rune expected[] = {U'a', U'é', U'中', U'🌍'};
+
+        Size index = 0;
+        for (Rune rune : s) {
+            ASSERT_LT(index, 4);
+            EXPECT_EQ(rune, expected[index++]);
+        }
+        EXPECT_EQ(index, 4);
+
+        auto it = s.end();
+        for (SSize i = 3; i >= 0; --i) {
+            --it;
+            EXPECT_EQ(*it, expected[i]);
+        }
+        EXPECT_TRUE(it == s.begin());
+
+        String empty;
+        EXPECT_TRUE(empty.begin() == empty.end());
+    }
+
+    // Tests bulk decoding of runes against indexed access.
+    TEST(StringTest, DecodeRunes) {
+        String text;
+        for (Int32 i = 0; i < 20; ++i) {
+            text = text + "plain ascii text here, " + "ünïcödé 中文 🌍 ";
+        }
+
+        Size length = text.length();
+        Rune* runes = new Rune[length];
+        EXPECT_EQ(text.decodeRunes(runes, length), length);
+        for (Size i = 0; i < length; ++i) {
+            ASSERT_EQ(runes[i], text.at(static_cast<SSize>(i)));
+        }
+
+        EXPECT_EQ(text.decodeRunes(runes, 10, length - 5), 5);
+        for (Size i = 0; i < 5; ++i) {
+            EXPECT_EQ(runes[i], text.at(static_cast<SSize>(length - 5 + i)));
+        }
+
+        EXPECT_EQ(text.decodeRunes(runes, 3, 40), 3);
+        EXPECT_EQ(runes[0], text.at(40));
+        delete[] runes;
+
+        EXPECT_THROW(text.decodeRunes(nullptr, 0, length + 1), OutOfRangeException);
+    }
+
+    // Tests whole-string case conversion for ASCII, mixed scripts and length-changing mappings.
+    TEST(StringTest, CaseConversion) {
+        EXPECT_EQ(String("Hello, World! 123").toUpperCase(), "HELLO, WORLD! 123");
+        EXPECT_EQ(String("Hello, World! 123").toLowerCase(), "hello, world! 123");
+        EXPECT_EQ(String("Straße Ελληνικά Кириллица").toUpperCase(), "STRAßE ΕΛΛΗΝΙΚΆ КИРИЛЛИЦА");
+        EXPECT_EQ(String("ÉCOLE Ελληνικά").toLowerCase(), "école ελληνικά");
+        EXPECT_EQ(String("").toUpperCase(), "");
+
+        // U+023A grows from two to three bytes when lower-cased, U+0131 shrinks to one when upper-cased.
+        String growing("ȺȺȺȺȺȺȺȺȺȺȺȺȺȺȺȺȺȺȺȺ");
+        String lowered = growing.toLowerCase();
+        EXPECT_EQ(lowered, "ⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥⱥ");
+        EXPECT_EQ(lowered.length(), 20);
+        EXPECT_EQ(lowered.rawLength(), 60);
+        EXPECT_EQ(String("ıı").toUpperCase(), "II");
+
+        String longText;
+        for (Int32 i = 0; i < 10; ++i) {
+            longText = longText + "The Quick Brown Fox Jumps Over The Lazy Dog ";
+        }
+        String upper = longText.toUpperCase();
+        EXPECT_EQ(upper.substring(0, 19), "THE QUICK BROWN FOX");
+        EXPECT_EQ(upper.toLowerCase(), longText.toLowerCase());
+        EXPECT_EQ(upper.length(), longText.length());
+    }
+
+    // Tests case folding of runes that have more than one case variant.
+    TEST(StringTest, CaseFold) {
+        EXPECT_EQ(String("HeLLo").caseFold(), "hello");
+        EXPECT_EQ(String("ΣΊΣΥΦΟΣ").caseFold(), String("σίσυφοσ"));
+        EXPECT_EQ(String("σίσυφος").caseFold(), String("σίσυφοσ"));
+        EXPECT_EQ(String("ſ").caseFold(), "s");
+    }
+
+    // Tests case-insensitive equality and ordering.
+    TEST(StringTest, IgnoreCaseComparison) {
+        EXPECT_TRUE(String("Content-Type").equalsIgnoreCase("content-type"));
+        EXPECT_TRUE(String("CONTENT-TYPE").equalsIgnoreCase("Content-Type"));
+        EXPECT_FALSE(String("Content-Type").equalsIgnoreCase("Content-Length"));
+        EXPECT_FALSE(String("abc").equalsIgnoreCase("abcd"));
+        EXPECT_TRUE(String("ΣΊΣΥΦΟΣ").equalsIgnoreCase("σίσυφος"));
+        EXPECT_TRUE(String("Straße").equalsIgnoreCase("STRAßE"));
+        EXPECT_TRUE(String("").equalsIgnoreCase(""));
+
+        String a;
+        String b;
+        for (Int32 i = 0; i < 8; ++i) {
+            a = a + "accept-encoding: gzip, ";
+            b = b + "Accept-Encoding: GZIP, ";
+        }
+        EXPECT_TRUE(a.equalsIgnoreCase(b));
+        EXPECT_EQ(a.compareIgnoreCase(b), 0);
+
+        EXPECT_LT(String("apple").compareIgnoreCase("BANANA"), 0);
+        EXPECT_GT(String("Banana").compareIgnoreCase("apple"), 0);
+        EXPECT_LT(String("abc").compareIgnoreCase("ABCD"), 0);
+        EXPECT_GT(String("abcd").compareIgnoreCase("ABC"), 0);
+        EXPECT_LT(String("a").compareIgnoreCase("é"), 0);
+        EXPECT_EQ(String("ÉCOLE").compareIgnoreCase("école"), 0);
+    }
+
+    // Tests that cached hashes follow the text through copies and never make equal strings compare unequal.
+    TEST(StringTest, CachedHashCode) {
+        String text("a heap allocated string used as a map key");
+        String copy(text);
+        Hash expected = text.hashCode();
+
+        EXPECT_EQ(copy.hashCode(), expected);
+        EXPECT_EQ(String(text).hashCode(), expected);
+        EXPECT_EQ(text, copy);
+
+        String other("a heap allocated string used as a map kez");
+        EXPECT_NE(other.hashCode(), expected);
+        EXPECT_NE(text, other);
+
+        String rebuilt = String("a heap allocated string ") + "used as a map key";
+        EXPECT_EQ(rebuilt, text);
+        EXPECT_EQ(rebuilt.hashCode(), expected);
+
+        String shortText("inline");
+        EXPECT_EQ(shortText.hashCode(), String("inline").hashCode());
+    }
 }
@@ -0,0 +1,101 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/StringView.h>
+#include <Cedar/Core/Exceptions/InvalidArgumentException.h>
+
+namespace Cedar::Core {
+
+    // Tests that a view over a String sees the same bytes and runes.
+    TEST(StringViewTest, ViewOverString) {
+        String owner("héllo wörld");
+        StringView view(owner);
+
+        EXPECT_EQ(view.rawData(), owner.rawString());
+        EXPECT_EQ(view.rawLength(), owner.rawLength());
+        EXPECT_EQ(view.length(), 11);
+        EXPECT_EQ(view.toString(), owner);
+        EXPECT_TRUE(view.contains("ö"));
+        EXPECT_FALSE(StringView().contains("x"));
+        EXPECT_TRUE(StringView().isEmpty());
+    }
+
+    // Tests that trimming and stripping slice the original buffer instead of copying.
+    TEST(StringViewTest, TrimAndStripWithoutCopy) {
+        String owner("  \t key=välue \n");
+        StringView trimmed = StringView(owner).trim();
+
+        EXPECT_EQ(trimmed, "key=välue");
+        EXPECT_EQ(trimmed.rawData(), owner.rawString() + 4);
+        EXPECT_EQ(trimmed.length(), 9);
+
+        EXPECT_EQ(trimmed.stripPrefix("key="), "välue");
+        EXPECT_EQ(trimmed.stripPrefix("nope"), trimmed);
+        EXPECT_EQ(trimmed.stripSuffix("ue"), "key=väl");
+        EXPECT_EQ(StringView("　 wide 　").trim(), "wide");
+    }
+
+    // Tests lazy splitting, including the empty segments and trailing delimiter rules of String::split.
+    TEST(StringViewTest, LazySplit) {
+        StringView text("GET /index.html  HTTP/1.1");
+        const char* expected[] = {"GET", "/index.html", "", "HTTP/1.1"};
+
+        Size count = 0;
+        for (StringView token : text.split(" ")) {
+            ASSERT_LT(count, 4);
+            EXPECT_EQ(token, expected[count]);
+            ++count;
+        }
+        EXPECT_EQ(count, 4);
+
+        count = 0;
+        for (StringView line : StringView("a\nb\n").lines()) {
+            EXPECT_EQ(line.length(), 1);
+            ++count;
+        }
+        EXPECT_EQ(count, 2);
+
+        auto whole = StringView("abc").split("");
+        auto it = whole.begin();
+        ASSERT_NE(it, whole.end());
+        EXPECT_EQ(*it, "abc");
+        EXPECT_EQ(++it, whole.end());
+
+        EXPECT_EQ(StringView("").split(",").begin(), StringView("").split(",").end());
+    }
+
+    // Tests that copying a view of malformed UTF-8 throws like String(CString, Size) instead of building a bad String.
+    TEST(StringViewTest, ToStringValidates) {
+        EXPECT_THROW((void) StringView("a\xC3", 2).toString(), InvalidArgumentException);
+        EXPECT_THROW((void) StringView("\xFF\xFE", 2).toString(), InvalidArgumentException);
+
+        // Splitting on a continuation byte cuts "é" in half.
+        auto halves = StringView("xéy").split("\xA9");
+        EXPECT_THROW((void) (*halves.begin()).toString(), InvalidArgumentException);
+
+        String copy = StringView("aé", 3).toString();
+        EXPECT_EQ(copy.length(), 2);
+        EXPECT_EQ(copy, "aé");
+    }
+}
@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 #include <Cedar/Core/Text/Unicode.h>
+#include <Cedar/Core/String.h>
 
 namespace Cedar::Core::Text {
 
@@ -118,4 +119,40 @@ namespace Cedar::Core::Text {
         EXPECT_EQ(Unicode::toLowerCase(0x0031), 0x0031); // '1' unchanged
         EXPECT_EQ(Unicode::toLowerCase(0x4E16), 0x4E16); // Chinese character '世' unchanged
     }
+
+    // Tests general category lookup across the Latin-1 range, other planes and invalid code points.
+    TEST(UnicodeTest, GeneralCategory) {
+        EXPECT_EQ(Unicode::generalCategory(0x0041), GeneralCategory::Lu); // 'A'
+        EXPECT_EQ(Unicode::generalCategory(0x0061), GeneralCategory::Ll); // 'a'
+        EXPECT_EQ(Unicode::generalCategory(0x0030), GeneralCategory::Nd); // '0'
+        EXPECT_EQ(Unicode::generalCategory(0x0020), GeneralCategory::Zs); // Space character
+        EXPECT_EQ(Unicode::generalCategory(0x0009), GeneralCategory::Cc); // Horizontal tab
+        EXPECT_EQ(Unicode::generalCategory(0x00A7), GeneralCategory::Po); // '§'
+
+        EXPECT_EQ(Unicode::generalCategory(0x01C5), GeneralCategory::Lt); // 'ǅ'
+        EXPECT_EQ(Unicode::generalCategory(0x0301), GeneralCategory::Mn); // Combining acute accent
+        EXPECT_EQ(Unicode::generalCategory(0x2028), GeneralCategory::Zl); // Line separator
+        EXPECT_EQ(Unicode::generalCategory(0x20AC), GeneralCategory::Sc); // '€'
+        EXPECT_EQ(Unicode::generalCategory(0xE000), GeneralCategory::Co); // Private use
+        EXPECT_EQ(Unicode::generalCategory(0x1D400), GeneralCategory::Lu); // Mathematical bold capital A
+        EXPECT_EQ(Unicode::generalCategory(0x1F30D), GeneralCategory::So); // '🌍'
+
+        EXPECT_EQ(Unicode::generalCategory(0x0378), GeneralCategory::Cn); // Unassigned
+        EXPECT_EQ(Unicode::generalCategory(0x110000), GeneralCategory::Cn);
+        EXPECT_EQ(Unicode::generalCategory(0xFFFFFFFF), GeneralCategory::Cn);
+    }
+
+    // Tests encoding runes of every UTF-8 length into strings, including U+0000.
+    TEST(UnicodeTest, EncodeRuneToString) {
+        EXPECT_EQ(Unicode::encodeRuneToString(0x41), "A");
+        EXPECT_EQ(Unicode::encodeRuneToString(0xE9).rawLength(), 2);
+        EXPECT_EQ(Unicode::encodeRuneToString(0x20AC), "\xE2\x82\xAC");
+        EXPECT_EQ(Unicode::encodeRuneToString(0x1F30D).rawLength(), 4);
+
+        String nul = Unicode::encodeRuneToString(0);
+        EXPECT_EQ(nul.rawLength(), 1);
+        EXPECT_EQ(nul.length(), 1);
+        EXPECT_EQ(nul[0], 0);
+        EXPECT_EQ(String(static_cast<Rune>(0)).rawLength(), 1);
+    }
 }
@@ -0,0 +1,78 @@
+/*
+ * Project: Cedar-Core
+ * Copyright (C) 2024 Cedar Community
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+#include <Cedar/Core/Threading/Epoch.h>
+#include <Cedar/Core/Threading/Thread.h>
+
+#include <atomic>
+
+namespace Cedar::Core::Threading {
+    static std::atomic<int> freedCount(0);
+
+    static void countFree(Pointer pointer) {
+        delete static_cast<int*>(pointer);
+        freedCount.fetch_add(1);
+    }
+
+    // Tests that retired memory is freed once no guard is held.
+    TEST(EpochTest, RetiredMemoryIsFreed) {
+        freedCount.store(0);
+        for (int i = 0; i < 10; ++i) {
+            Epoch::retire(new int(i), countFree);
+        }
+        for (int i = 0; i < 3; ++i) {
+            Epoch::collect();
+        }
+        EXPECT_EQ(freedCount.load(), 10);
+    }
+
+    // Tests that a guard held by another thread keeps retired memory alive.
+    TEST(EpochTest, GuardDelaysReclamation) {
+        freedCount.store(0);
+        std::atomic<bool> pinned(false);
+        std::atomic<bool> release(false);
+
+        Function<void> reader = [&]() {
+            Epoch::Guard guard;
+            pinned.store(true);
+            while (!release.load()) {}
+        };
+        Thread thread(reader);
+        thread.start();
+        while (!pinned.load()) {}
+
+        Epoch::retire(new int(1), countFree);
+        for (int i = 0; i < 3; ++i) {
+            Epoch::collect();
+        }
+        EXPECT_EQ(freedCount.load(), 0);
+
+        release.store(true);
+        thread.join();
+        for (int i = 0; i < 3; ++i) {
+            Epoch::collect();
+        }
+        EXPECT_EQ(freedCount.load(), 1);
+    }
+}
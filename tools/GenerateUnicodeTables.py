@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Project: Cedar-Core
+# Copyright (C) 2024 Cedar Community
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+"""Builds the general category trie in src/Text/Unicode/GeneralCategoryTable.h.
+
+The category ranges in tools/UnicodeCategories.txt are the source of truth;
+they are not compiled into the library. Rerun this script whenever they change:
+
+    python3 tools/GenerateUnicodeTables.py
+"""
+
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+RANGES = os.path.join(ROOT, "tools", "UnicodeCategories.txt")
+OUTPUT = os.path.join(ROOT, "src", "Text", "Unicode", "GeneralCategoryTable.h")
+
+# Must match the order of Cedar::Core::Text::GeneralCategory.
+CATEGORIES = [
+    "Cn",
+    "Lu", "Ll", "Lt", "Lm", "Lo",
+    "Mn", "Mc", "Me",
+    "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po",
+    "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp",
+    "Cc", "Cf", "Cs", "Co",
+]
+
+MAX_RUNE = 0x10FFFF
+LATIN1_LIMIT = 0x100
+
+LETTER_FLAG = 1
+DIGIT_FLAG = 2
+SPACE_FLAG = 4
+
+
+def parse_categories():
+    categories = bytearray(MAX_RUNE + 1)
+    with open(RANGES, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            name, start, end = line.split()
+            value = CATEGORIES.index(name)
+            for codepoint in range(int(start, 16), int(end, 16) + 1):
+                if categories[codepoint] not in (0, value):
+                    sys.exit("U+%04X is listed in both %s and %s" % (
+                        codepoint, CATEGORIES[categories[codepoint]], name))
+                categories[codepoint] = value
+    return categories
+
+
+def build_trie(categories, shift):
+    block_size = 1 << shift
+    blocks = {}
+    stage1 = []
+    stage2 = bytearray()
+    for base in range(0, MAX_RUNE + 1, block_size):
+        block = bytes(categories[base:base + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2 += block
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+def flags_of(category):
+    name = CATEGORIES[category]
+    flags = 0
+    if name[0] == "L":
+        flags |= LETTER_FLAG
+    if name == "Nd":
+        flags |= DIGIT_FLAG
+    if name in ("Zs", "Zl", "Zp", "Cc"):
+        flags |= SPACE_FLAG
+    return flags
+
+
+def format_array(values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("            " + " ".join("%d," % v for v in values[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def main():
+    categories = parse_categories()
+
+    # Pick the block size that gives the smallest pair of stages.
+    best = None
+    for shift in range(4, 12):
+        stage1, stage2 = build_trie(categories, shift)
+        index_size = 1 if len(stage2) >> shift <= 0x100 else 2
+        total = len(stage1) * index_size + len(stage2)
+        if best is None or total < best[0]:
+            best = (total, shift, stage1, stage2, index_size)
+    total, shift, stage1, stage2, index_size = best
+    index_type = "UInt8" if index_size == 1 else "UInt16"
+
+    with open(os.path.join(ROOT, "src", "Text", "Unicode.cpp"), encoding="utf-8") as f:
+        header = f.read().split("*/", 1)[0] + "*/"
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as out:
+        out.write(header + "\n\n")
+        out.write("// Generated by tools/GenerateUnicodeTables.py from UnicodeCategories.txt; do not edit.\n\n")
+        out.write("#pragma once\n\n")
+        out.write("#include <Cedar/Core/BasicTypes.h>\n\n")
+        out.write("namespace Cedar::Core::Text::GeneralCategoryTable {\n")
+        out.write("    constexpr UInt32 Shift = %d;\n" % shift)
+        out.write("    constexpr UInt32 BlockMask = %d;\n\n" % ((1 << shift) - 1))
+        out.write("    constexpr UInt8 LetterFlag = %d;\n" % LETTER_FLAG)
+        out.write("    constexpr UInt8 DigitFlag = %d;\n" % DIGIT_FLAG)
+        out.write("    constexpr UInt8 SpaceFlag = %d;\n\n" % SPACE_FLAG)
+        out.write("    // Property flags for U+0000..U+00FF, checked before the trie.\n")
+        out.write("    constexpr UInt8 Latin1Flags[%d] = {\n" % LATIN1_LIMIT)
+        out.write(format_array([flags_of(categories[c]) for c in range(LATIN1_LIMIT)], 32) + "\n")
+        out.write("    };\n\n")
+        out.write("    // Block index for each 2^Shift code points.\n")
+        out.write("    constexpr %s Stage1[%d] = {\n" % (index_type, len(stage1)))
+        out.write(format_array(stage1, 24) + "\n")
+        out.write("    };\n\n")
+        out.write("    // Deduplicated blocks of GeneralCategory values.\n")
+        out.write("    constexpr UInt8 Stage2[%d] = {\n" % len(stage2))
+        out.write(format_array(list(stage2), 32) + "\n")
+        out.write("    };\n")
+        out.write("}\n")
+
+    print("shift %d: %d stage-1 entries, %d stage-2 bytes, %d bytes total"
+          % (shift, len(stage1), len(stage2), total))
+
+
+if __name__ == "__main__":
+    main()